@@ -6,12 +6,19 @@
 
 #include "ArduinoJson/version.hpp"
 
+#include "ArduinoJson/Deserialization/JsonArrayReader.hpp"
+#include "ArduinoJson/Deserialization/JsonLinesReader.hpp"
+#include "ArduinoJson/Deserialization/JsonPullParser.hpp"
+#include "ArduinoJson/Deserialization/JsonPushParser.hpp"
 #include "ArduinoJson/DynamicJsonBuffer.hpp"
 #include "ArduinoJson/JsonArray.hpp"
 #include "ArduinoJson/JsonObject.hpp"
+#include "ArduinoJson/Serialization/JsonChunkedSerializer.hpp"
+#include "ArduinoJson/Serialization/JsonSegmentBuilder.hpp"
 #include "ArduinoJson/StaticJsonBuffer.hpp"
 
 #include "ArduinoJson/Deserialization/JsonParserImpl.hpp"
+#include "ArduinoJson/Deserialization/StructuralParserImpl.hpp"
 #include "ArduinoJson/JsonArrayImpl.hpp"
 #include "ArduinoJson/JsonBufferImpl.hpp"
 #include "ArduinoJson/JsonObjectImpl.hpp"
@@ -44,6 +44,29 @@
 #define ARDUINOJSON_DEFAULT_NESTING_LIMIT 10
 #endif
 
+// Parse floats with a lighter algorithm, because the table of powers of five
+// used by the correctly rounded one takes 10KB
+#ifndef ARDUINOJSON_ENABLE_PRECISE_FLOAT_PARSING
+#define ARDUINOJSON_ENABLE_PRECISE_FLOAT_PARSING 0
+#endif
+
+// Print floats with up to 9 decimal places, because the shortest
+// representation requires 64-bit multiplications
+#ifndef ARDUINOJSON_ENABLE_SHORTEST_FLOAT_SERIALIZATION
+#define ARDUINOJSON_ENABLE_SHORTEST_FLOAT_SERIALIZATION 0
+#endif
+
+// Find the chars to escape with a linear search, to save the 256 bytes of the
+// lookup table
+#ifndef ARDUINOJSON_ENABLE_ESCAPE_LOOKUP_TABLE
+#define ARDUINOJSON_ENABLE_ESCAPE_LOOKUP_TABLE 0
+#endif
+
+// Keys are compared to a JsonFilter in a buffer on the stack, keep it short
+#ifndef ARDUINOJSON_FILTER_KEY_MAX_LENGTH
+#define ARDUINOJSON_FILTER_KEY_MAX_LENGTH 32
+#endif
+
 #else  // ARDUINOJSON_EMBEDDED_MODE
 
 // On a computer we have plenty of memory so we can use doubles
@@ -84,6 +107,28 @@
 #define ARDUINOJSON_DEFAULT_NESTING_LIMIT 50
 #endif
 
+// On a computer, the 10KB table of powers of five is affordable, so we can
+// parse floats with correct rounding
+#ifndef ARDUINOJSON_ENABLE_PRECISE_FLOAT_PARSING
+#define ARDUINOJSON_ENABLE_PRECISE_FLOAT_PARSING 1
+#endif
+
+// Print floats with the shortest representation that parses back to the same
+// value
+#ifndef ARDUINOJSON_ENABLE_SHORTEST_FLOAT_SERIALIZATION
+#define ARDUINOJSON_ENABLE_SHORTEST_FLOAT_SERIALIZATION 1
+#endif
+
+// On a computer, find the chars to escape with a 256-byte lookup table
+#ifndef ARDUINOJSON_ENABLE_ESCAPE_LOOKUP_TABLE
+#define ARDUINOJSON_ENABLE_ESCAPE_LOOKUP_TABLE 1
+#endif
+
+// On a computer, a JsonFilter can match longer keys
+#ifndef ARDUINOJSON_FILTER_KEY_MAX_LENGTH
+#define ARDUINOJSON_FILTER_KEY_MAX_LENGTH 128
+#endif
+
 #endif  // ARDUINOJSON_EMBEDDED_MODE
 
 #ifdef ARDUINO
@@ -146,6 +191,61 @@
 #define ARDUINOJSON_NEGATIVE_EXPONENTIATION_THRESHOLD 1e-5
 #endif
 
+// Use SSE2 (or AVX2 if available) to skip spaces and copy strings when
+// parsing a string in RAM, and to find the chars to escape when serializing
+#ifndef ARDUINOJSON_ENABLE_SIMD
+#if defined(__SSE2__) && defined(__GNUC__)
+#define ARDUINOJSON_ENABLE_SIMD 1
+#else
+#define ARDUINOJSON_ENABLE_SIMD 0
+#endif
+#endif
+
+// Index the keys of large JsonObjects in a hash table allocated in the
+// JsonBuffer, so that lookups don't have to scan the whole object
+#ifndef ARDUINOJSON_ENABLE_OBJECT_INDEX
+#define ARDUINOJSON_ENABLE_OBJECT_INDEX 0
+#endif
+
+// Minimum number of keys before a JsonObject builds its index
+#ifndef ARDUINOJSON_OBJECT_INDEX_THRESHOLD
+#define ARDUINOJSON_OBJECT_INDEX_THRESHOLD 16
+#endif
+
+// Index the elements of large JsonArrays in a table allocated in the
+// JsonBuffer, so that accessing an element by index doesn't have to walk the
+// list
+#ifndef ARDUINOJSON_ENABLE_ARRAY_INDEX
+#define ARDUINOJSON_ENABLE_ARRAY_INDEX 0
+#endif
+
+// Minimum number of elements before a JsonArray builds its index
+#ifndef ARDUINOJSON_ARRAY_INDEX_THRESHOLD
+#define ARDUINOJSON_ARRAY_INDEX_THRESHOLD 16
+#endif
+
+// Parse strings in RAM in two stages: first locate the structural characters
+// in blocks of 64 bytes, then build the tree from these positions.
+// The result is identical to the default parser.
+#ifndef ARDUINOJSON_ENABLE_STRUCTURAL_PARSER
+#define ARDUINOJSON_ENABLE_STRUCTURAL_PARSER 0
+#endif
+
+// Convert numbers, true and false while parsing, instead of storing them as
+// unparsed strings that are converted each time they are read
+#ifndef ARDUINOJSON_ENABLE_EAGER_TYPING
+#define ARDUINOJSON_ENABLE_EAGER_TYPING 0
+#endif
+
+// Remember the result of JsonArray::measureLength() and
+// JsonObject::measureLength() until a JsonArray or a JsonObject of the
+// JsonBuffer is modified.
+// CAUTION: changes made through an iterator or to a string that was not
+// duplicated are not detected.
+#ifndef ARDUINOJSON_ENABLE_LENGTH_CACHE
+#define ARDUINOJSON_ENABLE_LENGTH_CACHE 0
+#endif
+
 #if ARDUINOJSON_USE_LONG_LONG && ARDUINOJSON_USE_INT64
 #error ARDUINOJSON_USE_LONG_LONG and ARDUINOJSON_USE_INT64 cannot be set together
 #endif
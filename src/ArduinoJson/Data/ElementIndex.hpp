@@ -0,0 +1,89 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include "../JsonBuffer.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+// A table of iterators to the elements of a JsonArray, in order.
+// It is used by JsonArray when ARDUINOJSON_ENABLE_ARRAY_INDEX is set, to
+// access elements by index in constant time, and lives in the JsonBuffer like
+// the rest of the array.
+// Removing an element still takes linear time: the table shifts the following
+// slots, and the list walks to the previous node.
+// Since a JsonBuffer cannot release memory, the table doubles its capacity
+// each time it's full, so that the abandoned tables never use more than the
+// current one.
+template <typename TIterator>
+class ElementIndex {
+ public:
+  ElementIndex() : _slots(NULL), _capacity(0), _size(0) {}
+
+  bool isBuilt() const {
+    return _slots != NULL;
+  }
+
+  // Returns the number of indexed elements
+  size_t size() const {
+    return _size;
+  }
+
+  // Indexes all the elements of the range.
+  // Returns false if the table couldn't be allocated.
+  bool build(JsonBuffer *buffer, TIterator begin, TIterator end, size_t count) {
+    if (!allocate(buffer, capacityFor(count))) return false;
+    for (TIterator it = begin; it != end; ++it) _slots[_size++] = it;
+    return true;
+  }
+
+  // Returns the element at the specified index, which must be valid.
+  TIterator at(size_t index) const {
+    return _slots[index];
+  }
+
+  // Adds an element at the end.
+  // If the table needs to grow but the allocation fails, the index is dropped.
+  void add(JsonBuffer *buffer, TIterator it) {
+    if (_size == _capacity) {
+      TIterator *oldSlots = _slots;
+      size_t oldSize = _size;
+      if (!allocate(buffer, _capacity * 2)) return;
+      for (size_t i = 0; i < oldSize; i++) _slots[i] = oldSlots[i];
+      _size = oldSize;
+    }
+    _slots[_size++] = it;
+  }
+
+  // Removes an element and shifts the following ones (linear time).
+  void remove(TIterator it) {
+    size_t i = 0;
+    while (i < _size && _slots[i] != it) i++;
+    if (i == _size) return;  // not indexed
+    for (_size--; i < _size; i++) _slots[i] = _slots[i + 1];
+  }
+
+ private:
+  static size_t capacityFor(size_t count) {
+    size_t capacity = 8;
+    while (capacity < count) capacity *= 2;
+    return capacity;
+  }
+
+  bool allocate(JsonBuffer *buffer, size_t capacity) {
+    void *p = buffer ? buffer->alloc(capacity * sizeof(TIterator)) : NULL;
+    _slots = static_cast<TIterator *>(p);
+    _capacity = _slots ? capacity : 0;
+    _size = 0;
+    return _slots != NULL;
+  }
+
+  TIterator *_slots;
+  size_t _capacity;
+  size_t _size;
+};
+}  // namespace Internals
+}  // namespace ArduinoJson
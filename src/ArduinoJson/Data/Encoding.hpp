@@ -4,11 +4,27 @@
 
 #pragma once
 
+#include "../Configuration.hpp"
+
 namespace ArduinoJson {
 namespace Internals {
 
 class Encoding {
  public:
+#if ARDUINOJSON_ENABLE_ESCAPE_LOOKUP_TABLE
+  // Optimized for speed, with a table indexed by the char
+  static char escapeChar(char c) {
+    static const char table[256] = {
+        0, 0,   0, 0, 0, 0, 0, 0, 'b', 't', 'n', 0, 'f', 'r', 0, 0,  // 0x00
+        0, 0,   0, 0, 0, 0, 0, 0, 0,   0,   0,   0, 0,   0,   0, 0,  // 0x10
+        0, 0, '"', 0, 0, 0, 0, 0, 0,   0,   0,   0, 0,   0,   0, 0,  // 0x20
+        0, 0,   0, 0, 0, 0, 0, 0, 0,   0,   0,   0, 0,   0,   0, 0,  // 0x30
+        0, 0,   0, 0, 0, 0, 0, 0, 0,   0,   0,   0, 0,   0,   0, 0,  // 0x40
+        0, 0,   0, 0, 0, 0, 0, 0, 0,   0,   0,   0, '\\', 0, 0, 0  // 0x50
+    };  // the other chars are zero
+    return table[static_cast<unsigned char>(c)];
+  }
+#else
   // Optimized for code size on a 8-bit AVR
   static char escapeChar(char c) {
     const char *p = escapeTable(false);
@@ -17,6 +33,7 @@ class Encoding {
     }
     return p[0];
   }
+#endif
 
   // Optimized for code size on a 8-bit AVR
   static char unescapeChar(char c) {
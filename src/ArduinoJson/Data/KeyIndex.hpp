@@ -0,0 +1,126 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include "../JsonBuffer.hpp"
+#include "../StringTraits/StringTraits.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+// An open-addressing hash table of iterators to the pairs of a JsonObject.
+// It is used by JsonObject::findKey() when ARDUINOJSON_ENABLE_OBJECT_INDEX is
+// set, and lives in the JsonBuffer like the rest of the object.
+// Since a JsonBuffer cannot release memory, the table doubles its capacity
+// each time it's half full, so that the abandoned tables never use more than
+// the current one.
+template <typename TIterator>
+class KeyIndex {
+ public:
+  KeyIndex() : _slots(NULL), _capacity(0), _size(0) {}
+
+  bool isBuilt() const {
+    return _slots != NULL;
+  }
+
+  // Returns the number of indexed elements
+  size_t size() const {
+    return _size;
+  }
+
+  // Indexes all the elements of the range.
+  // Returns false if the table couldn't be allocated.
+  bool build(JsonBuffer *buffer, TIterator begin, TIterator end, size_t count) {
+    if (!allocate(buffer, capacityFor(count))) return false;
+    for (TIterator it = begin; it != end; ++it) insertInSlots(it);
+    return true;
+  }
+
+  // Returns the element associated with the key, or a null iterator.
+  template <typename TStringRef>
+  TIterator find(TStringRef key) const {
+    size_t mask = _capacity - 1;
+    size_t i = StringTraits<TStringRef>::hash(key) & mask;
+    for (;;) {
+      TIterator it = _slots[i];
+      if (it == TIterator()) return it;
+      if (StringTraits<TStringRef>::equals(key, it->key)) return it;
+      i = (i + 1) & mask;
+    }
+  }
+
+  // Adds an element whose key has already been set.
+  // If the table needs to grow but the allocation fails, the index is dropped.
+  void insert(JsonBuffer *buffer, TIterator it) {
+    if (2 * (_size + 1) > _capacity) {
+      TIterator *oldSlots = _slots;
+      size_t oldCapacity = _capacity;
+      if (!allocate(buffer, _capacity * 2)) return;
+      for (size_t i = 0; i < oldCapacity; i++) {
+        if (oldSlots[i] != TIterator()) insertInSlots(oldSlots[i]);
+      }
+    }
+    insertInSlots(it);
+  }
+
+  // Removes an element, shifting back the following elements of the cluster so
+  // that no tombstone is needed.
+  void remove(TIterator it) {
+    if (it == TIterator()) return;
+
+    size_t mask = _capacity - 1;
+    size_t i = homeSlot(it);
+    while (_slots[i] != it) {
+      if (_slots[i] == TIterator()) return;  // not indexed
+      i = (i + 1) & mask;
+    }
+
+    for (size_t j = (i + 1) & mask; _slots[j] != TIterator();
+         j = (j + 1) & mask) {
+      size_t k = homeSlot(_slots[j]);
+      // leave the element in place if its home slot is in (i, j]
+      bool inPlace = i <= j ? (i < k && k <= j) : (i < k || k <= j);
+      if (inPlace) continue;
+      _slots[i] = _slots[j];
+      i = j;
+    }
+    _slots[i] = TIterator();
+    _size--;
+  }
+
+ private:
+  static size_t capacityFor(size_t count) {
+    size_t capacity = 8;
+    while (capacity < 2 * count) capacity *= 2;
+    return capacity;
+  }
+
+  bool allocate(JsonBuffer *buffer, size_t capacity) {
+    void *p = buffer ? buffer->alloc(capacity * sizeof(TIterator)) : NULL;
+    _slots = static_cast<TIterator *>(p);
+    _capacity = _slots ? capacity : 0;
+    _size = 0;
+    for (size_t i = 0; i < _capacity; i++) _slots[i] = TIterator();
+    return _slots != NULL;
+  }
+
+  size_t homeSlot(TIterator it) const {
+    return StringTraits<const char *>::hash(it->key) & (_capacity - 1);
+  }
+
+  void insertInSlots(TIterator it) {
+    size_t mask = _capacity - 1;
+    size_t i = homeSlot(it);
+    while (_slots[i] != TIterator()) i = (i + 1) & mask;
+    _slots[i] = it;
+    _size++;
+  }
+
+  TIterator *_slots;
+  size_t _capacity;
+  size_t _size;
+};
+}  // namespace Internals
+}  // namespace ArduinoJson
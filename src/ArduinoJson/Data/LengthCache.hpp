@@ -0,0 +1,43 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include "../JsonBuffer.hpp"
+
+#if ARDUINOJSON_ENABLE_LENGTH_CACHE
+
+namespace ArduinoJson {
+namespace Internals {
+
+// The length of the JSON output of a JsonArray or a JsonObject, with the
+// revision of the JsonBuffer at the time it was measured.
+// It is used when ARDUINOJSON_ENABLE_LENGTH_CACHE is set, so that calling
+// measureLength() again on an unmodified document doesn't serialize it again.
+class LengthCache {
+ public:
+  LengthCache() : _revision(0), _length(0) {}
+
+  // Gets the length if no container of the JsonBuffer has been modified
+  // since it was set.
+  bool get(const JsonBuffer *buffer, size_t &length) const {
+    if (!buffer || buffer->revision() != _revision) return false;
+    length = _length;
+    return true;
+  }
+
+  void set(const JsonBuffer *buffer, size_t length) {
+    if (!buffer) return;
+    _revision = buffer->revision();
+    _length = length;
+  }
+
+ private:
+  size_t _revision;
+  size_t _length;
+};
+}
+}
+
+#endif
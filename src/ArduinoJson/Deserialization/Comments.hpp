@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include "Scanning.hpp"
+
 namespace ArduinoJson {
 namespace Internals {
 template <typename TInput>
@@ -15,7 +17,7 @@ void skipSpacesAndComments(TInput& input) {
       case '\t':
       case '\r':
       case '\n':
-        input.move();
+        skipSpaces(input);
         continue;
 
       // comments
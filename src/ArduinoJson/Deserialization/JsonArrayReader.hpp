@@ -0,0 +1,108 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include "../Configuration.hpp"
+#include "../DynamicJsonBuffer.hpp"
+#include "../JsonVariant.hpp"
+#include "../StringTraits/StringTraits.hpp"
+#include "JsonParser.hpp"
+
+namespace ArduinoJson {
+
+// Reads the elements of a top-level array one at a time, instead of parsing
+// the whole array with JsonBuffer::parseArray().
+// The input is any type supported by JsonBuffer::parse(): a string in RAM,
+// a Flash string, a std::istream or an Arduino Stream.
+//
+// Each element is parsed in the same DynamicJsonBuffer, which is recycled
+// before each element, so the memory usage depends on the largest element
+// rather than on the whole array. As a consequence, the JsonVariant of an
+// element is only valid until the next call to next().
+// The strings are always copied to the DynamicJsonBuffer, even from a char*.
+//
+// Example:
+//   JsonArrayReader<std::istream> reader(file);
+//   while (reader.next()) {
+//     JsonVariant element = reader.element();
+//     ...
+//   }
+//   if (reader.failed()) ...
+template <typename TString>
+class JsonArrayReader {
+  typedef typename Internals::StringTraits<TString>::Reader Reader;
+  typedef Internals::JsonParser<Reader, DynamicJsonBuffer &> Parser;
+
+ public:
+  // The nesting limit includes the array
+  JsonArrayReader(Reader reader,
+                  uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT,
+                  DuplicateKeyPolicy duplicateKeys = DUPLICATE_KEYS_KEEP_LAST)
+      : _parser(&_buffer, reader, _buffer,
+                nestingLimit ? uint8_t(nestingLimit - 1) : 0, duplicateKeys),
+        _state(nestingLimit ? STATE_START : STATE_ERROR) {}
+
+  // Parses the next element.
+  // Returns false after the last element, or if the input is invalid.
+  bool next() {
+    switch (_state) {
+      case STATE_START:
+        if (!_parser.eat('[')) return fail();
+        if (_parser.eat(']')) return end();
+        return parseElement();
+
+      case STATE_ELEMENT:
+        if (_parser.eat(']')) return end();
+        if (!_parser.eat(',')) return fail();
+        return parseElement();
+
+      default:  // STATE_END or STATE_ERROR
+        return false;
+    }
+  }
+
+  // The last element read by next()
+  JsonVariant element() const {
+    return _element;
+  }
+
+  // Tells whether the input is not a valid array
+  bool failed() const {
+    return _state == STATE_ERROR;
+  }
+
+ private:
+  enum State { STATE_START, STATE_ELEMENT, STATE_END, STATE_ERROR };
+
+  JsonArrayReader(const JsonArrayReader &);             // non-copiable
+  JsonArrayReader &operator=(const JsonArrayReader &);  // non-copiable
+
+  bool parseElement() {
+    _buffer.recycle();
+    _element = _parser.parseVariant();
+    if (!_element.success()) return fail();
+    _state = STATE_ELEMENT;
+    return true;
+  }
+
+  bool end() {
+    _element = JsonVariant();
+    _state = STATE_END;
+    return false;
+  }
+
+  bool fail() {
+    _element = JsonVariant();
+    _state = STATE_ERROR;
+    return false;
+  }
+
+  // declared before the parser, which refers to it
+  DynamicJsonBuffer _buffer;
+  Parser _parser;
+  JsonVariant _element;
+  State _state;
+};
+}  // namespace ArduinoJson
@@ -0,0 +1,85 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <string.h>  // for strcmp
+
+#include "../JsonArray.hpp"
+#include "../JsonObject.hpp"
+#include "../JsonVariant.hpp"
+
+namespace ArduinoJson {
+
+// Selects the values that JsonBuffer::parse() stores, the others are only
+// validated and don't take memory in the JsonBuffer.
+// The filter mirrors the structure of the document:
+// - true keeps a value and everything inside it,
+// - an object keeps the members whose key is in the filter, with the value
+//   of that key as their filter,
+// - an array keeps the elements, with its first element as their filter,
+// - anything else discards the value.
+// A key can only be matched if it's shorter than
+// ARDUINOJSON_FILTER_KEY_MAX_LENGTH.
+//
+// Example: {"list":[{"id":true}]} keeps only the ids of the elements of
+// "list".
+class JsonFilter {
+ public:
+  explicit JsonFilter(const JsonVariant &filter) : _filter(filter) {}
+
+  const JsonVariant &variant() const {
+    return _filter;
+  }
+
+ private:
+  JsonVariant _filter;
+};
+
+namespace Internals {
+
+// Tells whether the value with the filter *filter is kept.
+// If it is, filter becomes the filter of its content, or NULL if the
+// value is kept as a whole.
+inline bool applyFilter(const JsonVariant *&filter) {
+  if (filter->is<JsonObject>() || filter->is<JsonArray>()) return true;
+  if (!filter->is<bool>() || !filter->as<bool>()) return false;
+  filter = NULL;
+  return true;
+}
+
+// Finds the filter of the member of an object.
+// Returns false if the member is discarded.
+inline bool filterMember(const JsonVariant &objectFilter, const char *key,
+                         const JsonVariant *&filter) {
+  if (!key || !objectFilter.is<JsonObject>()) return false;
+  const JsonObject &object = objectFilter.as<JsonObject>();
+  for (JsonObject::const_iterator it = object.begin(); it != object.end();
+       ++it) {
+    if (!strcmp(it->key, key)) {
+      filter = &it->value;
+      return applyFilter(filter);
+    }
+  }
+  return false;
+}
+
+// Finds the filter of the elements of an array.
+// Returns false if the elements are discarded.
+inline bool filterElement(const JsonVariant &arrayFilter,
+                          const JsonVariant *&filter) {
+  if (!arrayFilter.is<JsonArray>()) return false;
+  JsonArray::const_iterator first = arrayFilter.as<JsonArray>().begin();
+  if (first == JsonArray::const_iterator()) return false;
+  filter = &*first;
+  return applyFilter(filter);
+}
+
+// Tells whether an array (or an object) matches the filter of its content.
+inline bool filterAccepts(const JsonVariant *filter, bool isObject) {
+  if (!filter) return true;
+  return isObject ? filter->is<JsonObject>() : filter->is<JsonArray>();
+}
+}
+}
@@ -0,0 +1,134 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <string.h>  // for memchr, memcpy
+
+#include "../Configuration.hpp"
+#include "../DynamicJsonBuffer.hpp"
+#include "../JsonVariant.hpp"
+#include "Scanning.hpp"
+
+#if ARDUINOJSON_ENABLE_STD_STREAM
+#include <istream>
+#endif
+
+namespace ArduinoJson {
+
+// Reads newline-delimited JSON (JSON Lines, NDJSON) one record at a time.
+//
+// All the records are parsed in the same DynamicJsonBuffer, which is
+// recycled before each record: only its largest block is kept, so once it's
+// big enough, reading a record doesn't allocate anything. As a consequence,
+// the JsonVariant of a record is only valid until the next call to next().
+//
+// Blank lines are skipped. A line that is not valid JSON gives an invalid
+// record, and the reader continues with the next line.
+//
+// Example:
+//   JsonLinesReader reader(std::cin);
+//   while (reader.next()) {
+//     JsonVariant record = reader.record();
+//     if (record.success()) ...
+//   }
+class JsonLinesReader {
+ public:
+  // Reads the lines between begin and end.
+  // Like JsonBuffer::parse(char*), the records are parsed in place, so the
+  // memory must be writable: each newline is replaced by a null-terminator.
+  JsonLinesReader(char *begin, char *end,
+                  uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT)
+      : _ptr(begin),
+        _end(end),
+#if ARDUINOJSON_ENABLE_STD_STREAM
+        _stream(NULL),
+#endif
+        _nestingLimit(nestingLimit) {
+  }
+
+#if ARDUINOJSON_ENABLE_STD_STREAM
+  // Reads the lines of a stream, until its end
+  explicit JsonLinesReader(
+      std::istream &stream,
+      uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT)
+      : _ptr(NULL), _end(NULL), _stream(&stream), _nestingLimit(nestingLimit) {}
+#endif
+
+  // Parses the next record.
+  // Returns false at the end of the input.
+  bool next() {
+    _buffer.recycle();
+#if ARDUINOJSON_ENABLE_STD_STREAM
+    if (_stream) return nextInStream();
+#endif
+    return nextInRange();
+  }
+
+  // The last record read by next(), invalid if the line is not valid JSON
+  JsonVariant record() const {
+    return _record;
+  }
+
+ private:
+  JsonLinesReader(const JsonLinesReader &);             // non-copiable
+  JsonLinesReader &operator=(const JsonLinesReader &);  // non-copiable
+
+  bool nextInRange() {
+    while (_ptr < _end && Internals::isSpace(*_ptr)) _ptr++;
+    if (_ptr >= _end) return false;
+
+    char *line = _ptr;
+    size_t length = size_t(_end - _ptr);
+    char *eol = static_cast<char *>(memchr(_ptr, '\n', length));
+    if (eol) {
+      *eol = '\0';
+      _ptr = eol + 1;
+    } else {
+      // the last line has no newline to replace, so it's copied
+      line = static_cast<char *>(_buffer.alloc(length + 1));
+      if (line) {
+        memcpy(line, _ptr, length);
+        line[length] = '\0';
+      }
+      _ptr = _end;
+    }
+
+    _record = line ? _buffer.parse(line, _nestingLimit) : JsonVariant();
+    return true;
+  }
+
+#if ARDUINOJSON_ENABLE_STD_STREAM
+  bool nextInStream() {
+    *_stream >> std::ws;
+    if (_stream->peek() == std::char_traits<char>::eof()) return false;
+
+    // the line is copied to the buffer first, so that an invalid record,
+    // like an unclosed bracket, can't make the parser read the next lines
+    DynamicJsonBuffer::String line = _buffer.startString();
+    std::streambuf *buf = _stream->rdbuf();
+    for (;;) {
+      int c = buf->sbumpc();
+      if (c == std::char_traits<char>::eof() || c == '\n') break;
+      line.append(char(c));
+    }
+    const char *s = line.c_str();
+
+    // the copy belongs to the buffer, so it can be parsed in place
+    _record = s ? _buffer.parse(const_cast<char *>(s), _nestingLimit)
+                : JsonVariant();
+    return true;
+  }
+#endif
+
+  DynamicJsonBuffer _buffer;
+  JsonVariant _record;
+  char *_ptr;
+  char *_end;
+#if ARDUINOJSON_ENABLE_STD_STREAM
+  std::istream *_stream;
+#endif
+  uint8_t _nestingLimit;
+};
+}  // namespace ArduinoJson
@@ -4,10 +4,16 @@
 
 #pragma once
 
+#include "../DuplicateKeyPolicy.hpp"
 #include "../JsonBuffer.hpp"
 #include "../JsonVariant.hpp"
+#include "../TypeTraits/IsBaseOf.hpp"
 #include "../TypeTraits/IsConst.hpp"
+#include "JsonFilter.hpp"
+#include "ParserStack.hpp"
+#include "ScratchString.hpp"
 #include "StringWriter.hpp"
+#include "StructuralParser.hpp"
 
 namespace ArduinoJson {
 namespace Internals {
@@ -19,11 +25,14 @@ template <typename TReader, typename TWriter>
 class JsonParser {
  public:
   JsonParser(JsonBuffer *buffer, TReader reader, TWriter writer,
-             uint8_t nestingLimit)
+             uint8_t nestingLimit, DuplicateKeyPolicy duplicateKeys,
+             const JsonFilter *filter = NULL)
       : _buffer(buffer),
         _reader(reader),
         _writer(writer),
-        _nestingLimit(nestingLimit) {}
+        _nestingLimit(nestingLimit),
+        _duplicateKeys(duplicateKeys),
+        _filter(filter ? &filter->variant() : NULL) {}
 
   JsonArray &parseArray();
   JsonObject &parseObject();
@@ -34,48 +43,96 @@ class JsonParser {
     return result;
   }
 
- private:
-  JsonParser &operator=(const JsonParser &);  // non-copiable
+  // Adds a key-value pair to an object, applying the duplicate key policy.
+  // StructuralParser uses it too.
+  enum AddPairResult { PAIR_ADDED, PAIR_NO_MEMORY, PAIR_DUPLICATE_KEY };
+  static inline AddPairResult addPair(JsonObject &, const char *key,
+                                      const JsonVariant &value,
+                                      DuplicateKeyPolicy duplicateKeys);
 
-  static bool eat(TReader &, char charToSkip);
+  // Skips spaces and comments, then charToSkip if it's the next char.
+  // JsonArrayReader uses it to read the brackets and the commas between the
+  // elements.
   FORCE_INLINE bool eat(char charToSkip) {
     return eat(_reader, charToSkip);
   }
 
+ private:
+  JsonParser &operator=(const JsonParser &);  // non-copiable
+
+  static bool eat(TReader &, char charToSkip);
+
   const char *parseString();
+  template <typename TString>
+  void readString(TString &);
+  // Reads a key or a value without storing it
+  void skipString();
+  // Reads the key of a member of a filtered object.
+  // Sets keep to false if the member is discarded, in which case the key is
+  // not stored. Returns NULL if the member is kept but the key can't be
+  // stored.
+  const char *parseFilteredKey(const JsonVariant &objectFilter,
+                               const JsonVariant **filter, bool *keep);
   bool parseAnythingTo(JsonVariant *destination);
 
   inline bool parseArrayTo(JsonVariant *destination);
   inline bool parseObjectTo(JsonVariant *destination);
   inline bool parseStringTo(JsonVariant *destination);
 
-  static inline bool isBetween(char c, char min, char max) {
-    return min <= c && c <= max;
-  }
-
-  static inline bool canBeInNonQuotedString(char c) {
-    return isBetween(c, '0', '9') || isBetween(c, '_', 'z') ||
-           isBetween(c, 'A', 'Z') || c == '+' || c == '-' || c == '.';
-  }
+  // Parses the elements of an array or the members of an object, including
+  // the nested ones, after the opening bracket.
+  // Uses a ParserStack instead of recursion.
+  inline bool parseContent(void *root, bool isObject);
 
-  static inline bool isQuote(char c) {
-    return c == '\'' || c == '\"';
-  }
+  // Adds a value to the array or the object of the frame.
+  // Returns false if there is not enough memory, or if the key is a rejected
+  // duplicate.
+  FORCE_INLINE bool addValue(ParserStack::Frame &, const char *key,
+                             const JsonVariant &value);
 
   JsonBuffer *_buffer;
   TReader _reader;
   TWriter _writer;
   uint8_t _nestingLimit;
+  DuplicateKeyPolicy _duplicateKeys;
+  const JsonVariant *_filter;  // NULL to keep everything
 };
 
+// Selects the parser for a reader.
+// StructuralParser requires the whole input in RAM.
+template <typename TReader, typename TWriter,
+          bool = ARDUINOJSON_ENABLE_STRUCTURAL_PARSER &&
+                 IsBaseOf<ContiguousReader, TReader>::value>
+struct ParserFor {
+  typedef JsonParser<TReader, TWriter> type;
+};
+
+template <typename TReader, typename TWriter>
+struct ParserFor<TReader, TWriter, true> {
+  typedef StructuralParser<TReader, TWriter> type;
+};
+
+// StructuralParser doesn't support JsonFilter, so a filtered parse always
+// uses JsonParser
 template <typename TJsonBuffer, typename TString, typename Enable = void>
 struct JsonParserBuilder {
   typedef typename StringTraits<TString>::Reader InputReader;
-  typedef JsonParser<InputReader, TJsonBuffer &> TParser;
+  typedef typename ParserFor<InputReader, TJsonBuffer &>::type TParser;
+  typedef JsonParser<InputReader, TJsonBuffer &> TFilteredParser;
 
   static TParser makeParser(TJsonBuffer *buffer, TString &json,
-                            uint8_t nestingLimit) {
-    return TParser(buffer, InputReader(json), *buffer, nestingLimit);
+                            uint8_t nestingLimit,
+                            DuplicateKeyPolicy duplicateKeys) {
+    return TParser(buffer, InputReader(json), *buffer, nestingLimit,
+                   duplicateKeys);
+  }
+
+  static TFilteredParser makeFilteredParser(TJsonBuffer *buffer, TString &json,
+                                            const JsonFilter &filter,
+                                            uint8_t nestingLimit,
+                                            DuplicateKeyPolicy duplicateKeys) {
+    return TFilteredParser(buffer, InputReader(json), *buffer, nestingLimit,
+                           duplicateKeys, &filter);
   }
 };
 
@@ -84,19 +141,40 @@ struct JsonParserBuilder<TJsonBuffer, TChar *,
                          typename EnableIf<!IsConst<TChar>::value>::type> {
   typedef typename StringTraits<TChar *>::Reader TReader;
   typedef StringWriter<TChar> TWriter;
-  typedef JsonParser<TReader, TWriter> TParser;
+  typedef typename ParserFor<TReader, TWriter>::type TParser;
+  typedef JsonParser<TReader, TWriter> TFilteredParser;
 
   static TParser makeParser(TJsonBuffer *buffer, TChar *json,
-                            uint8_t nestingLimit) {
-    return TParser(buffer, TReader(json), TWriter(json), nestingLimit);
+                            uint8_t nestingLimit,
+                            DuplicateKeyPolicy duplicateKeys) {
+    return TParser(buffer, TReader(json), TWriter(json), nestingLimit,
+                   duplicateKeys);
+  }
+
+  static TFilteredParser makeFilteredParser(TJsonBuffer *buffer, TChar *json,
+                                            const JsonFilter &filter,
+                                            uint8_t nestingLimit,
+                                            DuplicateKeyPolicy duplicateKeys) {
+    return TFilteredParser(buffer, TReader(json), TWriter(json), nestingLimit,
+                           duplicateKeys, &filter);
   }
 };
 
 template <typename TJsonBuffer, typename TString>
 inline typename JsonParserBuilder<TJsonBuffer, TString>::TParser makeParser(
-    TJsonBuffer *buffer, TString &json, uint8_t nestingLimit) {
-  return JsonParserBuilder<TJsonBuffer, TString>::makeParser(buffer, json,
-                                                             nestingLimit);
+    TJsonBuffer *buffer, TString &json, uint8_t nestingLimit,
+    DuplicateKeyPolicy duplicateKeys) {
+  return JsonParserBuilder<TJsonBuffer, TString>::makeParser(
+      buffer, json, nestingLimit, duplicateKeys);
+}
+
+template <typename TJsonBuffer, typename TString>
+inline typename JsonParserBuilder<TJsonBuffer, TString>::TFilteredParser
+makeFilteredParser(TJsonBuffer *buffer, TString &json,
+                   const JsonFilter &filter, uint8_t nestingLimit,
+                   DuplicateKeyPolicy duplicateKeys) {
+  return JsonParserBuilder<TJsonBuffer, TString>::makeFilteredParser(
+      buffer, json, filter, nestingLimit, duplicateKeys);
 }
 }  // namespace Internals
 }  // namespace ArduinoJson
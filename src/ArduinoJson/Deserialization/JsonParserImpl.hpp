@@ -6,6 +6,7 @@
 
 #include "Comments.hpp"
 #include "JsonParser.hpp"
+#include "NonQuotedValue.hpp"
 
 template <typename TReader, typename TWriter>
 inline bool ArduinoJson::Internals::JsonParser<TReader, TWriter>::eat(
@@ -38,37 +39,15 @@ template <typename TReader, typename TWriter>
 inline ArduinoJson::JsonArray &
 ArduinoJson::Internals::JsonParser<TReader, TWriter>::parseArray() {
   if (_nestingLimit == 0) return JsonArray::invalid();
-  _nestingLimit--;
 
   // Create an empty array
   JsonArray &array = _buffer->createArray();
 
   // Check opening braket
-  if (!eat('[')) goto ERROR_MISSING_BRACKET;
-  if (eat(']')) goto SUCCESS_EMPTY_ARRAY;
+  if (!eat('[')) return JsonArray::invalid();
 
-  // Read each value
-  for (;;) {
-    // 1 - Parse value
-    JsonVariant value;
-    if (!parseAnythingTo(&value)) goto ERROR_INVALID_VALUE;
-    if (!array.add(value)) goto ERROR_NO_MEMORY;
-
-    // 2 - More values?
-    if (eat(']')) goto SUCCES_NON_EMPTY_ARRAY;
-    if (!eat(',')) goto ERROR_MISSING_COMMA;
-  }
-
-SUCCESS_EMPTY_ARRAY:
-SUCCES_NON_EMPTY_ARRAY:
-  _nestingLimit++;
+  if (!parseContent(&array, false)) return JsonArray::invalid();
   return array;
-
-ERROR_INVALID_VALUE:
-ERROR_MISSING_BRACKET:
-ERROR_MISSING_COMMA:
-ERROR_NO_MEMORY:
-  return JsonArray::invalid();
 }
 
 template <typename TReader, typename TWriter>
@@ -85,44 +64,173 @@ template <typename TReader, typename TWriter>
 inline ArduinoJson::JsonObject &
 ArduinoJson::Internals::JsonParser<TReader, TWriter>::parseObject() {
   if (_nestingLimit == 0) return JsonObject::invalid();
-  _nestingLimit--;
 
   // Create an empty object
   JsonObject &object = _buffer->createObject();
 
   // Check opening brace
-  if (!eat('{')) goto ERROR_MISSING_BRACE;
-  if (eat('}')) goto SUCCESS_EMPTY_OBJECT;
+  if (!eat('{')) return JsonObject::invalid();
+
+  if (!parseContent(&object, true)) return JsonObject::invalid();
+  return object;
+}
+
+template <typename TReader, typename TWriter>
+inline bool ArduinoJson::Internals::JsonParser<TReader, TWriter>::parseContent(
+    void *root, bool isObject) {
+  uint8_t remainingLevels = uint8_t(_nestingLimit - 1);
+  // the array or object being filled; the stack holds the enclosing ones
+  ParserStack::Frame current = {root, isObject, NULL, _filter};
+  if (current.filter) applyFilter(current.filter);
+  ParserStack stack(_buffer);
+
+  // a closing bracket is allowed right after the opening one
+  bool justOpened = true;
+  bool closing = false;
 
-  // Read each key value pair
   for (;;) {
-    // 1 - Parse key
-    const char *key = parseString();
-    if (!key) goto ERROR_INVALID_KEY;
-    if (!eat(':')) goto ERROR_MISSING_COLON;
-
-    // 2 - Parse value
-    JsonVariant value;
-    if (!parseAnythingTo(&value)) goto ERROR_INVALID_VALUE;
-    if (!object.set(key, value)) goto ERROR_NO_MEMORY;
-
-    // 3 - More keys/values?
-    if (eat('}')) goto SUCCESS_NON_EMPTY_OBJECT;
+    if (justOpened) {
+      justOpened = false;
+      closing = eat(current.isObject ? '}' : ']');
+    }
+
+    if (!closing) {
+      // 1 - Parse key, and see if the value is kept
+      const char *key = NULL;
+      bool keep = current.container != NULL;
+      const JsonVariant *filter = NULL;
+      if (current.isObject) {
+        if (!keep) {
+          skipString();
+        } else if (current.filter) {
+          key = parseFilteredKey(*current.filter, &filter, &keep);
+          if (keep && !key) goto ERROR_INVALID_KEY;
+        } else {
+          key = parseString();
+          if (!key) goto ERROR_INVALID_KEY;
+        }
+        if (!eat(':')) goto ERROR_MISSING_COLON;
+      } else if (keep && current.filter) {
+        keep = filterElement(*current.filter, filter);
+      }
+
+      // 2 - Go down into a nested array or object, it will be added when it's
+      // closed
+      skipSpacesAndComments(_reader);
+      char c = _reader.current();
+      if (c == '[' || c == '{') {
+        if (remainingLevels == 0) goto ERROR_TOO_DEEP;
+        void *nested = NULL;
+        if (keep && filterAccepts(filter, c == '{')) {
+          if (c == '[')
+            nested = &_buffer->createArray();
+          else
+            nested = &_buffer->createObject();
+        }
+        _reader.move();
+        if (!stack.push(current)) goto ERROR_NO_MEMORY;
+        current.container = nested;
+        current.isObject = c == '{';
+        current.key = key;
+        current.filter = filter;
+        remainingLevels--;
+        justOpened = true;
+        continue;
+      }
+
+      // 3 - Parse value, a value with a filter of its content is discarded
+      if (keep && !filter) {
+        JsonVariant value;
+        if (!parseStringTo(&value)) goto ERROR_INVALID_VALUE;
+        if (!addValue(current, key, value)) goto ERROR_CANNOT_ADD;
+      } else {
+        skipString();
+      }
+    }
+
+    // 4 - More values? Closing brackets go up until a comma is found
+    while (closing || eat(current.isObject ? '}' : ']')) {
+      closing = false;
+      if (stack.empty()) return true;
+      ParserStack::Frame closed = current;
+      current = stack.top();
+      stack.pop();
+      remainingLevels++;
+      if (!closed.container) continue;
+
+      // an invalid container means that the JsonBuffer was full
+      JsonVariant value;
+      if (closed.isObject)
+        value = *static_cast<JsonObject *>(closed.container);
+      else
+        value = *static_cast<JsonArray *>(closed.container);
+      if (!value.success()) goto ERROR_NO_MEMORY;
+      if (!addValue(current, closed.key, value)) goto ERROR_CANNOT_ADD;
+    }
     if (!eat(',')) goto ERROR_MISSING_COMMA;
   }
 
-SUCCESS_EMPTY_OBJECT:
-SUCCESS_NON_EMPTY_OBJECT:
-  _nestingLimit++;
-  return object;
-
 ERROR_INVALID_KEY:
 ERROR_INVALID_VALUE:
-ERROR_MISSING_BRACE:
 ERROR_MISSING_COLON:
 ERROR_MISSING_COMMA:
 ERROR_NO_MEMORY:
-  return JsonObject::invalid();
+ERROR_CANNOT_ADD:
+ERROR_TOO_DEEP:
+  return false;
+}
+
+template <typename TReader, typename TWriter>
+inline const char *
+ArduinoJson::Internals::JsonParser<TReader, TWriter>::parseFilteredKey(
+    const JsonVariant &objectFilter, const JsonVariant **filter, bool *keep) {
+  char buffer[ARDUINOJSON_FILTER_KEY_MAX_LENGTH];
+  ScratchString key(buffer, sizeof(buffer));
+  readString(key);
+  *keep = filterMember(objectFilter, key.c_str(), *filter);
+  if (!*keep) return NULL;
+
+  // the key is only stored if the member is kept
+  typename RemoveReference<TWriter>::type::String str = _writer.startString();
+  str.append(buffer, strlen(buffer));
+  return str.c_str();
+}
+
+template <typename TReader, typename TWriter>
+inline bool ArduinoJson::Internals::JsonParser<TReader, TWriter>::addValue(
+    ParserStack::Frame &frame, const char *key, const JsonVariant &value) {
+  if (!frame.isObject)
+    return static_cast<JsonArray *>(frame.container)->add(value);
+  return addPair(*static_cast<JsonObject *>(frame.container), key, value,
+                 _duplicateKeys) == PAIR_ADDED;
+}
+
+template <typename TReader, typename TWriter>
+inline typename ArduinoJson::Internals::JsonParser<TReader,
+                                                   TWriter>::AddPairResult
+ArduinoJson::Internals::JsonParser<TReader, TWriter>::addPair(
+    JsonObject &object, const char *key, const JsonVariant &value,
+    DuplicateKeyPolicy duplicateKeys) {
+  switch (duplicateKeys) {
+    case DUPLICATE_KEYS_KEEP_ALL:
+      break;
+
+    case DUPLICATE_KEYS_KEEP_FIRST:
+      if (object.containsKey(key)) return PAIR_ADDED;
+      break;
+
+    case DUPLICATE_KEYS_REJECT:
+      if (object.containsKey(key)) return PAIR_DUPLICATE_KEY;
+      break;
+
+    default:  // DUPLICATE_KEYS_KEEP_LAST
+      return object.set(key, value) ? PAIR_ADDED : PAIR_NO_MEMORY;
+  }
+
+  // no need to search the key again
+  return object.append_impl<const char *, const JsonVariant &>(key, value)
+             ? PAIR_ADDED
+             : PAIR_NO_MEMORY;
 }
 
 template <typename TReader, typename TWriter>
@@ -139,45 +247,36 @@ template <typename TReader, typename TWriter>
 inline const char *
 ArduinoJson::Internals::JsonParser<TReader, TWriter>::parseString() {
   typename RemoveReference<TWriter>::type::String str = _writer.startString();
+  readString(str);
+  return str.c_str();
+}
 
+template <typename TReader, typename TWriter>
+template <typename TString>
+inline void ArduinoJson::Internals::JsonParser<TReader, TWriter>::readString(
+    TString &str) {
   skipSpacesAndComments(_reader);
-  char c = _reader.current();
-
-  if (isQuote(c)) {  // quotes
-    _reader.move();
-    char stopChar = c;
-    for (;;) {
-      c = _reader.current();
-      if (c == '\0') break;
-      _reader.move();
-
-      if (c == stopChar) break;
-
-      if (c == '\\') {
-        // replace char
-        c = Encoding::unescapeChar(_reader.current());
-        if (c == '\0') break;
-        _reader.move();
-      }
-
-      str.append(c);
-    }
-  } else {  // no quotes
-    for (;;) {
-      if (!canBeInNonQuotedString(c)) break;
-      _reader.move();
-      str.append(c);
-      c = _reader.current();
-    }
+  if (isQuote(_reader.current())) {
+    readQuotedString(_reader, str);
+  } else {
+    readNonQuotedString(_reader, str);
   }
+}
 
-  return str.c_str();
+template <typename TReader, typename TWriter>
+inline void
+ArduinoJson::Internals::JsonParser<TReader, TWriter>::skipString() {
+  ScratchString str(NULL, 0);
+  readString(str);
 }
 
 template <typename TReader, typename TWriter>
 inline bool ArduinoJson::Internals::JsonParser<TReader, TWriter>::parseStringTo(
     JsonVariant *destination) {
   bool hasQuotes = isQuote(_reader.current());
+#if ARDUINOJSON_ENABLE_EAGER_TYPING
+  if (!hasQuotes) return readNonQuotedValue(_reader, _writer, destination);
+#endif
   const char *value = parseString();
   if (value == NULL) return false;
   if (hasQuotes) {
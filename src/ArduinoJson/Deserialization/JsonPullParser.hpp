@@ -0,0 +1,212 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <string.h>  // for strcmp
+
+#include "../Configuration.hpp"
+#include "../JsonVariant.hpp"
+#include "../Polyfills/isFloat.hpp"
+#include "../Polyfills/isInteger.hpp"
+#include "../StringTraits/StringTraits.hpp"
+#include "Comments.hpp"
+#include "Scanning.hpp"
+#include "ScratchString.hpp"
+
+namespace ArduinoJson {
+
+// The tokens returned by JsonPullParser::next()
+enum JsonToken {
+  JSON_TOKEN_BEGIN_ARRAY,
+  JSON_TOKEN_END_ARRAY,
+  JSON_TOKEN_BEGIN_OBJECT,
+  JSON_TOKEN_END_OBJECT,
+  JSON_TOKEN_KEY,      // string() is the key
+  JSON_TOKEN_STRING,   // string() is the value
+  JSON_TOKEN_NUMBER,   // string() is the number, as written in the input
+  JSON_TOKEN_BOOLEAN,  // string() is "true" or "false"
+  JSON_TOKEN_NULL,     // string() is "null"
+  JSON_TOKEN_END,      // the whole value has been read
+  JSON_TOKEN_ERROR     // invalid input, too deep, or string too long
+};
+
+// Reads a JSON document one token at a time, without building a tree.
+// The input is any type supported by JsonBuffer::parse(): a string in RAM,
+// a Flash string or a stream.
+//
+// Keys and strings are unescaped in a scratch buffer provided by the caller:
+// string() stays valid until the next call to next(), and a string longer
+// than the buffer is an error. The arrays and objects that are open are
+// remembered with one bit per level, so the memory usage doesn't depend on
+// the size of the document.
+//
+// Unlike JsonBuffer::parse(), a value without quotes must be a number, true,
+// false or null.
+template <typename TString>
+class JsonPullParser {
+  typedef typename Internals::StringTraits<TString>::Reader Reader;
+
+ public:
+  JsonPullParser(Reader reader, char *scratch, size_t scratchSize,
+                 uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT)
+      : _reader(reader),
+        _scratch(scratch),
+        _scratchSize(scratchSize),
+        _string(NULL),
+        _token(JSON_TOKEN_ERROR),
+        _state(STATE_VALUE),
+        _depth(0),
+        _nestingLimit(nestingLimit) {}
+
+  // Reads the next token
+  JsonToken next() {
+    switch (_state) {
+      case STATE_FIRST:
+        if (eat(closingBracket())) return closeBlock();
+        return inObject() ? readKey() : readValue();
+
+      case STATE_NEXT:
+        if (_depth == 0) return emit(JSON_TOKEN_END, STATE_DONE);
+        if (eat(closingBracket())) return closeBlock();
+        if (!eat(',')) return fail();
+        return inObject() ? readKey() : readValue();
+
+      case STATE_VALUE:
+        return readValue();
+
+      case STATE_DONE:
+        return JSON_TOKEN_END;
+
+      default:  // STATE_ERROR
+        return JSON_TOKEN_ERROR;
+    }
+  }
+
+  // The last token returned by next()
+  JsonToken token() const {
+    return _token;
+  }
+
+  // The text of the last key, string, number, boolean or null
+  const char *string() const {
+    return _string;
+  }
+
+  // The last string, number, boolean or null, as it would be stored in a
+  // JsonArray or a JsonObject, so it can be converted with as<T>().
+  // Like string(), it's valid until the next call to next().
+  JsonVariant value() const {
+    if (_token == JSON_TOKEN_STRING || _token == JSON_TOKEN_KEY)
+      return JsonVariant(_string);
+    return JsonVariant(RawJson(_string));
+  }
+
+  // Number of arrays and objects that are open
+  uint8_t depth() const {
+    return _depth;
+  }
+
+ private:
+  enum State {
+    STATE_FIRST,  // after [ or {: a value, a key or the closing bracket
+    STATE_NEXT,   // after a value: a comma or the closing bracket
+    STATE_VALUE,  // after a colon, or at the beginning of the input
+    STATE_DONE,
+    STATE_ERROR
+  };
+
+  bool eat(char c) {
+    Internals::skipSpacesAndComments(_reader);
+    if (_reader.current() != c) return false;
+    _reader.move();
+    return true;
+  }
+
+  bool inObject() const {
+    return (_blocks[(_depth - 1) / 8] >> ((_depth - 1) % 8)) & 1;
+  }
+
+  char closingBracket() const {
+    return inObject() ? '}' : ']';
+  }
+
+  JsonToken emit(JsonToken token, State state) {
+    _state = state;
+    _token = token;
+    return token;
+  }
+
+  JsonToken fail() {
+    _string = NULL;
+    return emit(JSON_TOKEN_ERROR, STATE_ERROR);
+  }
+
+  JsonToken openBlock(bool isObject) {
+    if (_depth >= _nestingLimit) return fail();
+    _reader.move();
+    uint8_t mask = uint8_t(1 << (_depth % 8));
+    if (isObject)
+      _blocks[_depth / 8] |= mask;
+    else
+      _blocks[_depth / 8] &= uint8_t(~mask);
+    _depth++;
+    return emit(isObject ? JSON_TOKEN_BEGIN_OBJECT : JSON_TOKEN_BEGIN_ARRAY,
+                STATE_FIRST);
+  }
+
+  JsonToken closeBlock() {
+    JsonToken token = inObject() ? JSON_TOKEN_END_OBJECT : JSON_TOKEN_END_ARRAY;
+    _depth--;
+    return emit(token, STATE_NEXT);
+  }
+
+  JsonToken readKey() {
+    Internals::skipSpacesAndComments(_reader);
+    Internals::ScratchString str(_scratch, _scratchSize);
+    if (Internals::isQuote(_reader.current()))
+      Internals::readQuotedString(_reader, str);
+    else
+      Internals::readNonQuotedString(_reader, str);
+    _string = str.c_str();
+    if (!_string || !eat(':')) return fail();
+    return emit(JSON_TOKEN_KEY, STATE_VALUE);
+  }
+
+  JsonToken readValue() {
+    Internals::skipSpacesAndComments(_reader);
+    char c = _reader.current();
+    if (c == '[' || c == '{') return openBlock(c == '{');
+
+    Internals::ScratchString str(_scratch, _scratchSize);
+    if (Internals::isQuote(c)) {
+      Internals::readQuotedString(_reader, str);
+      _string = str.c_str();
+      if (!_string) return fail();
+      return emit(JSON_TOKEN_STRING, STATE_NEXT);
+    }
+
+    Internals::readNonQuotedString(_reader, str);
+    _string = str.c_str();
+    if (!_string) return fail();
+    if (!strcmp(_string, "true") || !strcmp(_string, "false"))
+      return emit(JSON_TOKEN_BOOLEAN, STATE_NEXT);
+    if (!strcmp(_string, "null")) return emit(JSON_TOKEN_NULL, STATE_NEXT);
+    if (Internals::isInteger(_string) || Internals::isFloat(_string))
+      return emit(JSON_TOKEN_NUMBER, STATE_NEXT);
+    return fail();
+  }
+
+  Reader _reader;
+  char *_scratch;
+  size_t _scratchSize;
+  const char *_string;
+  JsonToken _token;
+  State _state;
+  uint8_t _depth;
+  uint8_t _nestingLimit;
+  // one bit per level: 1 for an object, 0 for an array
+  uint8_t _blocks[32];
+};
+}  // namespace ArduinoJson
@@ -0,0 +1,423 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include "../Configuration.hpp"
+#include "../Data/Encoding.hpp"
+#include "../DuplicateKeyPolicy.hpp"
+#include "../JsonArray.hpp"
+#include "../JsonObject.hpp"
+#include "../JsonVariant.hpp"
+#include "JsonParser.hpp"
+#include "NonQuotedValue.hpp"
+#include "ParserStack.hpp"
+#include "Scanning.hpp"
+
+namespace ArduinoJson {
+
+// Parses a JSON document that arrives in chunks, for example from a network
+// connection, without copying the whole input first.
+// Each call to feed() parses a chunk and stops at its end, even in the
+// middle of a string or a number; the next call resumes from there.
+//
+// The tree is the same as JsonBuffer::parse() would build with the whole
+// input, and the strings are always copied to the JsonBuffer.
+// A number, true, false or null at the top level is only complete after
+// finish(), since more digits could follow.
+//
+// Example:
+//   DynamicJsonBuffer jb;
+//   JsonPushParser<DynamicJsonBuffer> parser(jb);
+//   while (!parser.complete() && !parser.failed()) {
+//     size_t n = client.read(chunk, sizeof(chunk));
+//     if (n == 0) break;
+//     parser.feed(chunk, n);
+//   }
+//   parser.finish();
+//   JsonObject& root = parser.result().as<JsonObject>();
+template <typename TJsonBuffer>
+class JsonPushParser {
+  typedef typename TJsonBuffer::String String;
+  typedef Internals::ParserStack ParserStack;
+  // only used for addPair(), which doesn't depend on the reader
+  typedef Internals::JsonParser<Internals::CharPointerTraits<char>::Reader,
+                                TJsonBuffer &>
+      TreeParser;
+
+ public:
+  JsonPushParser(TJsonBuffer &buffer,
+                 uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT,
+                 DuplicateKeyPolicy duplicateKeys = DUPLICATE_KEYS_KEEP_LAST)
+      : _buffer(&buffer),
+        _stack(&buffer),
+        _string(buffer.startString()),
+        _key(NULL),
+        _state(STATE_VALUE),
+        _returnState(STATE_VALUE),
+        _quote(0),
+        _isKey(false),
+        _spilled(false),
+        _tokenLength(0),
+        _remainingLevels(0),
+        _nestingLimit(nestingLimit),
+        _duplicateKeys(duplicateKeys) {
+    ParserStack::Frame root = {NULL, false, NULL, NULL};
+    _current = root;
+  }
+
+  // Parses a chunk of the input.
+  // Returns false if the input is invalid, or if the JsonBuffer is full.
+  // Once the value is complete, the rest of the input is ignored.
+  bool feed(const char *data, size_t length) {
+    const char *end = data + length;
+    while (data < end && _state < STATE_DONE) {
+      if (_state == STATE_STRING) {
+        // copy the chars that don't need a decision at once
+        const char *run = data;
+        while (run < end && !Internals::endsStringRun(*run, _quote)) run++;
+        if (run > data) {
+          _string.append(data, size_t(run - data));
+          data = run;
+          continue;
+        }
+      }
+      process(*data++);
+    }
+    return _state != STATE_ERROR;
+  }
+
+  // Tells that the input ended, like the null-terminator of a string.
+  // Returns true if the value is complete.
+  bool finish() {
+    if (_state < STATE_DONE) process('\0');
+    return complete();
+  }
+
+  // Tells whether the value is complete
+  bool complete() const {
+    return _state == STATE_DONE;
+  }
+
+  // Tells whether the input is invalid, or the JsonBuffer is full
+  bool failed() const {
+    return _state == STATE_ERROR;
+  }
+
+  // The parsed value, undefined until it's complete
+  JsonVariant result() const {
+    return _result;
+  }
+
+ private:
+  enum State {
+    STATE_VALUE,        // a value is expected
+    STATE_FIRST,        // after [ or {: an element or the closing bracket
+    STATE_KEY,          // after a comma in an object
+    STATE_COLON,        // after a key
+    STATE_AFTER_VALUE,  // a comma or the closing bracket
+    STATE_STRING,       // in a string with quotes
+    STATE_ESCAPE,       // after a backslash in a string with quotes
+    STATE_TOKEN,        // in a string without quotes
+    STATE_SLASH,        // after a slash that may start a comment
+    STATE_BLOCK_COMMENT,
+    STATE_BLOCK_COMMENT_STAR,
+    STATE_LINE_COMMENT,
+    STATE_DONE,
+    STATE_ERROR
+  };
+
+  JsonPushParser(const JsonPushParser &);             // non-copiable
+  JsonPushParser &operator=(const JsonPushParser &);  // non-copiable
+
+  // A null char is the end of the input, as for JsonParser
+  void process(char c) {
+    step(c, true);
+    if (c == '\0' && _state != STATE_DONE) _state = STATE_ERROR;
+  }
+
+  // canStartComment is false for a slash that was not followed by a star or
+  // another slash
+  void step(char c, bool canStartComment) {
+    switch (_state) {
+      case STATE_VALUE:
+      case STATE_FIRST:
+      case STATE_KEY:
+      case STATE_COLON:
+      case STATE_AFTER_VALUE:
+        if (Internals::isSpace(c)) return;
+        if (c == '/' && canStartComment) {
+          _returnState = _state;
+          _state = STATE_SLASH;
+          return;
+        }
+        break;
+
+      default:
+        break;
+    }
+
+    switch (_state) {
+      case STATE_VALUE:
+        return onValue(c, canStartComment);
+
+      case STATE_FIRST:
+        if (c == closingBracket()) return closeBlock();
+        if (_current.isObject) return onKey(c, canStartComment);
+        return onValue(c, canStartComment);
+
+      case STATE_KEY:
+        return onKey(c, canStartComment);
+
+      case STATE_COLON:
+        _state = c == ':' ? STATE_VALUE : STATE_ERROR;
+        return;
+
+      case STATE_AFTER_VALUE:
+        if (c == closingBracket()) return closeBlock();
+        if (c != ',') return fail();
+        _state = _current.isObject ? STATE_KEY : STATE_VALUE;
+        return;
+
+      case STATE_STRING:
+        if (c == '\\') {
+          _state = STATE_ESCAPE;
+          return;
+        }
+        if (c == _quote) return endString();
+        if (c == '\0') {
+          endString();
+          return step(c, canStartComment);
+        }
+        _string.append(c);
+        return;
+
+      case STATE_ESCAPE:
+        if (c == '\0') {
+          endString();
+          return step(c, canStartComment);
+        }
+        _string.append(Internals::Encoding::unescapeChar(c));
+        _state = STATE_STRING;
+        return;
+
+      case STATE_TOKEN:
+        return onToken(c, canStartComment);
+
+      case STATE_SLASH:
+        _state = _returnState;
+        if (c == '*') {
+          _state = STATE_BLOCK_COMMENT;
+          return;
+        }
+        if (c == '/') {
+          _state = STATE_LINE_COMMENT;
+          return;
+        }
+        // not a comment, just a '/'
+        step('/', false);
+        return step(c, true);
+
+      case STATE_BLOCK_COMMENT:
+        if (c == '*') _state = STATE_BLOCK_COMMENT_STAR;
+        if (c == '\0') {
+          _state = _returnState;
+          return step(c, true);
+        }
+        return;
+
+      case STATE_BLOCK_COMMENT_STAR:
+        if (c == '/') {
+          _state = _returnState;
+        } else if (c == '\0') {
+          _state = _returnState;
+          return step(c, true);
+        } else if (c != '*') {
+          _state = STATE_BLOCK_COMMENT;
+        }
+        return;
+
+      case STATE_LINE_COMMENT:
+        if (c == '\n') _state = _returnState;
+        if (c == '\0') {
+          _state = _returnState;
+          return step(c, true);
+        }
+        return;
+
+      default:  // STATE_DONE or STATE_ERROR
+        return;
+    }
+  }
+
+  void onKey(char c, bool canStartComment) {
+    _isKey = true;
+    startString(c, canStartComment);
+  }
+
+  void onValue(char c, bool canStartComment) {
+    if (c == '[' || c == '{') return openBlock(c == '{');
+    _isKey = false;
+    startString(c, canStartComment);
+  }
+
+  void startString(char c, bool canStartComment) {
+    if (Internals::isQuote(c)) {
+      _string = _buffer->startString();
+      _quote = c;
+      _state = STATE_STRING;
+    } else {
+      _spilled = false;
+      _tokenLength = 0;
+      _state = STATE_TOKEN;
+      onToken(c, canStartComment);
+    }
+  }
+
+  void endString() {
+    const char *s = _string.c_str();
+    if (!s) return fail();
+    if (_isKey) {
+      _key = s;
+      _state = STATE_COLON;
+    } else {
+      addValue(s);
+    }
+  }
+
+  // The first chars of a string without quotes are kept in _token, like
+  // readNonQuotedValue() does, to convert it without storing the text.
+  // A longer string is moved to the JsonBuffer.
+  void onToken(char c, bool canStartComment) {
+    if (Internals::canBeInNonQuotedString(c)) {
+      if (_spilled) {
+        _string.append(c);
+      } else if (_tokenLength < sizeof(_token) - 1) {
+        _token[_tokenLength++] = c;
+      } else {
+        _string = _buffer->startString();
+        _string.append(_token, _tokenLength);
+        _string.append(c);
+        _spilled = true;
+      }
+      return;
+    }
+
+    endToken();
+    step(c, canStartComment);
+  }
+
+  void endToken() {
+#if ARDUINOJSON_ENABLE_EAGER_TYPING
+    if (!_isKey && !_spilled) {
+      _token[_tokenLength] = '\0';
+      JsonVariant value;
+      if (Internals::parseTypedValue(_token, value)) return addValue(value);
+    }
+#endif
+    if (!_spilled) {
+      _string = _buffer->startString();
+      _string.append(_token, _tokenLength);
+    }
+    const char *s = _string.c_str();
+    if (!s) return fail();
+    if (_isKey) {
+      _key = s;
+      _state = STATE_COLON;
+    } else {
+      addValue(RawJson(s));
+    }
+  }
+
+  char closingBracket() const {
+    return _current.isObject ? '}' : ']';
+  }
+
+  void openBlock(bool isObject) {
+    bool isRoot = _current.container == NULL;
+    if (isRoot ? _nestingLimit == 0 : _remainingLevels == 0) return fail();
+
+    void *container;
+    if (isObject)
+      container = &_buffer->createObject();
+    else
+      container = &_buffer->createArray();
+
+    if (isRoot) {
+      _remainingLevels = uint8_t(_nestingLimit - 1);
+    } else {
+      if (!_stack.push(_current)) return fail();
+      _remainingLevels--;
+    }
+    _current.container = container;
+    _current.isObject = isObject;
+    _current.key = _key;
+    _state = STATE_FIRST;
+  }
+
+  void closeBlock() {
+    // an invalid container means that the JsonBuffer was full
+    JsonVariant value;
+    if (_current.isObject)
+      value = *static_cast<JsonObject *>(_current.container);
+    else
+      value = *static_cast<JsonArray *>(_current.container);
+
+    if (_stack.empty()) {
+      if (!value.success()) return fail();
+      _result = value;
+      _state = STATE_DONE;
+      return;
+    }
+
+    const char *key = _current.key;
+    _current = _stack.top();
+    _stack.pop();
+    _remainingLevels++;
+    if (!value.success()) return fail();
+    _key = key;
+    addValue(value);
+  }
+
+  void addValue(const JsonVariant &value) {
+    if (_current.container == NULL) {
+      _result = value;
+      _state = STATE_DONE;
+      return;
+    }
+
+    bool added;
+    if (_current.isObject) {
+      JsonObject &object = *static_cast<JsonObject *>(_current.container);
+      added = TreeParser::addPair(object, _key, value, _duplicateKeys) ==
+              TreeParser::PAIR_ADDED;
+    } else {
+      added = static_cast<JsonArray *>(_current.container)->add(value);
+    }
+    if (!added) return fail();
+    _state = STATE_AFTER_VALUE;
+  }
+
+  void fail() {
+    _state = STATE_ERROR;
+  }
+
+  TJsonBuffer *_buffer;
+  ParserStack _stack;
+  ParserStack::Frame _current;  // container is NULL before the root is open
+  String _string;
+  const char *_key;
+  JsonVariant _result;
+  State _state;
+  State _returnState;  // the state to go back to after a comment
+  char _quote;
+  bool _isKey;
+  bool _spilled;  // the string without quotes is in _string, not in _token
+  uint8_t _tokenLength;
+  uint8_t _remainingLevels;
+  uint8_t _nestingLimit;
+  DuplicateKeyPolicy _duplicateKeys;
+  char _token[64];
+};
+}  // namespace ArduinoJson
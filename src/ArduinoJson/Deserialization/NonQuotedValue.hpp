@@ -0,0 +1,92 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <string.h>  // for strcmp
+
+#include "../JsonVariant.hpp"
+#include "../Polyfills/isFloat.hpp"
+#include "../Polyfills/isInteger.hpp"
+#include "../Polyfills/parseFloat.hpp"
+#include "../TypeTraits/RemoveReference.hpp"
+#include "Scanning.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+// Converts an integer to a JsonVariant.
+// Returns false if it doesn't fit in a JsonInteger or a JsonUInt.
+inline bool parseTypedInteger(const char *s, JsonVariant &result) {
+  bool negative = *s == '-';
+  if (issign(*s)) s++;
+
+  JsonUInt value = 0;
+  for (; *s; s++) {
+    JsonUInt digit = JsonUInt(*s - '0');
+    if (value > (~JsonUInt(0) - digit) / 10) return false;
+    value = value * 10 + digit;
+  }
+
+  if (!negative || value == 0) {
+    result = value;
+    return true;
+  }
+
+  const JsonUInt maxMagnitude = ~JsonUInt(0) / 2 + 1;
+  if (value > maxMagnitude) return false;
+  result = -static_cast<JsonInteger>(value - 1) - 1;
+  return true;
+}
+
+// Converts a number, true, false or null to a JsonVariant.
+// Returns false if the text must be kept.
+inline bool parseTypedValue(const char *s, JsonVariant &result) {
+  if (!strcmp(s, "true")) {
+    result = true;
+    return true;
+  }
+  if (!strcmp(s, "false")) {
+    result = false;
+    return true;
+  }
+  if (!strcmp(s, "null")) {
+    result = RawJson("null");  // no need to copy the string
+    return true;
+  }
+  if (isInteger(s)) return parseTypedInteger(s, result);
+  if (isFloat(s)) {
+    result = parseFloat<JsonFloat>(s);
+    return true;
+  }
+  return false;
+}
+
+// Reads a non-quoted value and converts it when possible.
+// The text is copied to the writer only if it can't be converted.
+template <typename TReader, typename TWriter>
+bool readNonQuotedValue(TReader &reader, TWriter &writer,
+                        JsonVariant *destination) {
+  char buffer[64];
+  size_t n = 0;
+  while (n < sizeof(buffer) - 1 && canBeInNonQuotedString(reader.current())) {
+    buffer[n++] = reader.current();
+    reader.move();
+  }
+  buffer[n] = '\0';
+
+  if (!canBeInNonQuotedString(reader.current()) &&
+      parseTypedValue(buffer, *destination))
+    return true;
+
+  typename RemoveReference<TWriter>::type::String str = writer.startString();
+  str.append(buffer, n);
+  readNonQuotedString(reader, str);
+  const char *value = str.c_str();
+  if (value == NULL) return false;
+  *destination = RawJson(value);
+  return true;
+}
+}  // namespace Internals
+}  // namespace ArduinoJson
@@ -0,0 +1,83 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include "../JsonBuffer.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+// The stack of the arrays and objects that JsonParser is filling, innermost
+// last.
+// The first levels are stored in the ParserStack itself; the deeper ones
+// are allocated in the JsonBuffer, a block at a time, so that a deep
+// document costs memory in the JsonBuffer rather than native stack frames.
+// The blocks are reused when the parser goes up and down again.
+class ParserStack {
+ public:
+  struct Frame {
+    void *container;            // JsonArray or JsonObject, NULL if discarded
+    bool isObject;
+    const char *key;            // the key in the enclosing object
+    const JsonVariant *filter;  // the filter of the content, NULL for all
+  };
+
+  explicit ParserStack(JsonBuffer *buffer)
+      : _buffer(buffer), _block(&_firstBlock), _size(0) {
+    _firstBlock.previous = NULL;
+    _firstBlock.next = NULL;
+  }
+
+  bool empty() const {
+    return _size == 0 && _block->previous == NULL;
+  }
+
+  Frame &top() {
+    return _block->frames[_size - 1];
+  }
+
+  // Returns false if the JsonBuffer is full
+  bool push(const Frame &frame) {
+    if (_size == blockSize) {
+      if (!_block->next && !allocateNextBlock()) return false;
+      _block = _block->next;
+      _size = 0;
+    }
+    _block->frames[_size++] = frame;
+    return true;
+  }
+
+  void pop() {
+    if (--_size == 0 && _block->previous) {
+      _block = _block->previous;
+      _size = blockSize;
+    }
+  }
+
+ private:
+  static const size_t blockSize = 16;
+
+  struct Block {
+    Block *previous;
+    Block *next;
+    Frame frames[blockSize];
+  };
+
+  bool allocateNextBlock() {
+    Block *block = static_cast<Block *>(_buffer->alloc(sizeof(Block)));
+    if (!block) return false;
+    block->previous = _block;
+    block->next = NULL;
+    _block->next = block;
+    return true;
+  }
+
+  JsonBuffer *_buffer;
+  Block *_block;
+  size_t _size;  // in the current block
+  Block _firstBlock;
+};
+}
+}
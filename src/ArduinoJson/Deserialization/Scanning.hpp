@@ -0,0 +1,170 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <stddef.h>  // for size_t
+#include <stdint.h>  // for uint32_t, uintptr_t
+
+#include "../Configuration.hpp"
+#include "../Data/Encoding.hpp"
+#include "../Polyfills/SimdBlock.hpp"
+#include "../Polyfills/attributes.hpp"
+#include "../StringTraits/StringTraits.hpp"
+#include "../TypeTraits/EnableIf.hpp"
+#include "../TypeTraits/IsBaseOf.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+inline bool isSpace(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+inline bool isBetween(char c, char min, char max) {
+  return min <= c && c <= max;
+}
+
+inline bool canBeInNonQuotedString(char c) {
+  return isBetween(c, '0', '9') || isBetween(c, '_', 'z') ||
+         isBetween(c, 'A', 'Z') || c == '+' || c == '-' || c == '.';
+}
+
+inline bool isQuote(char c) {
+  return c == '\'' || c == '\"';
+}
+
+inline bool endsStringRun(char c, char stopChar) {
+  return c == stopChar || c == '\\' || c == '\0';
+}
+
+#if ARDUINOJSON_ENABLE_SIMD
+
+// Returns the number of consecutive spaces at the beginning of s
+NO_SANITIZE_ADDRESS inline size_t countSpaces(const char* s) {
+  size_t offset = reinterpret_cast<uintptr_t>(s) % SimdBlock::size;
+  const char* p = s - offset;
+  for (;;) {
+    SimdBlock block(p);
+    uint32_t spaces = block.equals(' ') | block.equals('\t') |
+                      block.equals('\r') | block.equals('\n');
+    uint32_t others = (~spaces & SimdBlock::allBits) >> offset << offset;
+    if (others) return size_t(p - s) + size_t(__builtin_ctz(others));
+    p += SimdBlock::size;
+    offset = 0;
+  }
+}
+
+// Returns the number of characters at the beginning of s that can be copied
+// as is in a string delimited by stopChar
+NO_SANITIZE_ADDRESS inline size_t countStringChars(const char* s,
+                                                   char stopChar) {
+  size_t offset = reinterpret_cast<uintptr_t>(s) % SimdBlock::size;
+  const char* p = s - offset;
+  for (;;) {
+    SimdBlock block(p);
+    uint32_t stops =
+        block.equals(stopChar) | block.equals('\\') | block.equals('\0');
+    stops = stops >> offset << offset;
+    if (stops) return size_t(p - s) + size_t(__builtin_ctz(stops));
+    p += SimdBlock::size;
+    offset = 0;
+  }
+}
+
+#else  // ARDUINOJSON_ENABLE_SIMD
+
+// Returns the number of consecutive spaces at the beginning of s
+inline size_t countSpaces(const char* s) {
+  const char* p = s;
+  while (isSpace(*p)) p++;
+  return size_t(p - s);
+}
+
+// Returns the number of characters at the beginning of s that can be copied
+// as is in a string delimited by stopChar
+inline size_t countStringChars(const char* s, char stopChar) {
+  const char* p = s;
+  while (!endsStringRun(*p, stopChar)) p++;
+  return size_t(p - s);
+}
+
+#endif  // ARDUINOJSON_ENABLE_SIMD
+
+// Skips consecutive spaces.
+// This version is for readers that can only be read one character at a time.
+template <typename TReader>
+typename EnableIf<!IsBaseOf<ContiguousReader, TReader>::value>::type
+skipSpaces(TReader& reader) {
+  while (isSpace(reader.current())) reader.move();
+}
+//
+// This version is for readers whose input is in RAM.
+template <typename TReader>
+typename EnableIf<IsBaseOf<ContiguousReader, TReader>::value>::type
+skipSpaces(TReader& reader) {
+  reader.skip(countSpaces(reader.ptr()));
+}
+
+// Copies the characters of a quoted string until the closing quote, a
+// backslash or the end of the input.
+// This version is for readers that can only be read one character at a time.
+template <typename TReader, typename TString>
+typename EnableIf<!IsBaseOf<ContiguousReader, TReader>::value>::type
+copyStringChars(TReader& reader, TString& str, char stopChar) {
+  for (;;) {
+    char c = reader.current();
+    if (endsStringRun(c, stopChar)) break;
+    reader.move();
+    str.append(c);
+  }
+}
+//
+// This version is for readers whose input is in RAM.
+template <typename TReader, typename TString>
+typename EnableIf<IsBaseOf<ContiguousReader, TReader>::value>::type
+copyStringChars(TReader& reader, TString& str, char stopChar) {
+  const char* s = reader.ptr();
+  size_t n = countStringChars(s, stopChar);
+  str.append(s, n);
+  reader.skip(n);
+}
+
+// Reads a quoted string and unescapes the special chars.
+// The reader must be on the opening quote; it stops after the closing quote.
+template <typename TReader, typename TString>
+void readQuotedString(TReader& reader, TString& str) {
+  char stopChar = reader.current();
+  reader.move();
+  for (;;) {
+    // copy everything up to the next quote or backslash
+    copyStringChars(reader, str, stopChar);
+
+    char c = reader.current();
+    if (c == '\0') break;
+    reader.move();
+
+    if (c == stopChar) break;
+
+    // replace escaped char
+    c = Encoding::unescapeChar(reader.current());
+    if (c == '\0') break;
+    reader.move();
+
+    str.append(c);
+  }
+}
+
+// Reads a string without quotes, as allowed for keys and values
+template <typename TReader, typename TString>
+void readNonQuotedString(TReader& reader, TString& str) {
+  for (;;) {
+    char c = reader.current();
+    if (!canBeInNonQuotedString(c)) break;
+    reader.move();
+    str.append(c);
+  }
+}
+}  // namespace Internals
+}  // namespace ArduinoJson
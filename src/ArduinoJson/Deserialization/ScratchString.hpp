@@ -0,0 +1,41 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <stddef.h>  // for size_t
+
+namespace ArduinoJson {
+namespace Internals {
+
+// A string that the parsers build in a fixed-size buffer, outside of the
+// JsonBuffer.
+// c_str() returns NULL if the buffer is too small.
+// With a size of 0, the chars are only skipped.
+class ScratchString {
+ public:
+  ScratchString(char *buffer, size_t size)
+      : _start(buffer), _end(buffer + size), _ptr(buffer) {}
+
+  void append(char c) {
+    if (_ptr < _end) *_ptr++ = c;
+  }
+
+  void append(const char *s, size_t n) {
+    while (n--) append(*s++);
+  }
+
+  const char *c_str() {
+    if (_ptr >= _end) return NULL;
+    *_ptr = '\0';
+    return _start;
+  }
+
+ private:
+  char *_start;
+  char *_end;
+  char *_ptr;
+};
+}
+}
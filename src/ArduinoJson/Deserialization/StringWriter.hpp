@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <string.h>  // for memmove
+
 namespace ArduinoJson {
 namespace Internals {
 
@@ -18,6 +20,12 @@ class StringWriter {
       *(*_writePtr)++ = TChar(c);
     }
 
+    // the source may overlap the destination, since it's the same buffer
+    void append(const char* s, size_t n) {
+      memmove(*_writePtr, s, n);
+      *_writePtr += n;
+    }
+
     const char* c_str() const {
       *(*_writePtr)++ = 0;
       return reinterpret_cast<const char*>(_startPtr);
@@ -0,0 +1,211 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include "Scanning.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+inline bool isStructural(char c) {
+  return c == '{' || c == '}' || c == '[' || c == ']' || c == ':' || c == ',';
+}
+
+inline uint8_t countTrailingZeros(uint64_t bits) {
+#ifdef __GNUC__
+  return static_cast<uint8_t>(__builtin_ctzll(bits));
+#else
+  uint8_t n = 0;
+  while (!(bits & 1)) {
+    bits >>= 1;
+    n++;
+  }
+  return n;
+#endif
+}
+
+// The bit i of each mask tells if the char i of a block is of this kind
+struct BlockMasks {
+  uint64_t quotes;
+  uint64_t backslashes;
+  uint64_t structurals;
+  uint64_t spaces;
+  uint64_t unsupported;  // comments and single quotes
+  uint64_t terminators;
+};
+
+#if ARDUINOJSON_ENABLE_SIMD
+
+// Blocks are aligned, so that the loads never cross a page boundary
+const size_t blockAlignment = 64;
+
+NO_SANITIZE_ADDRESS inline void classifyBlock(const char* p, BlockMasks& m) {
+  m.quotes = m.backslashes = m.structurals = 0;
+  m.spaces = m.unsupported = m.terminators = 0;
+  for (size_t i = 0; i < 64; i += SimdBlock::size) {
+    SimdBlock block(p + i);
+    m.quotes |= uint64_t(block.equals('"')) << i;
+    m.backslashes |= uint64_t(block.equals('\\')) << i;
+    m.structurals |=
+        uint64_t(block.equals('{') | block.equals('}') | block.equals('[') |
+                 block.equals(']') | block.equals(':') | block.equals(','))
+        << i;
+    m.spaces |= uint64_t(block.equals(' ') | block.equals('\t') |
+                         block.equals('\r') | block.equals('\n'))
+                << i;
+    m.unsupported |= uint64_t(block.equals('/') | block.equals('\'')) << i;
+    m.terminators |= uint64_t(block.equals('\0')) << i;
+  }
+}
+
+#else  // ARDUINOJSON_ENABLE_SIMD
+
+const size_t blockAlignment = 1;
+
+// Stops at the terminator, so it never reads past the end of the input
+inline void classifyBlock(const char* p, BlockMasks& m) {
+  m.quotes = m.backslashes = m.structurals = 0;
+  m.spaces = m.unsupported = m.terminators = 0;
+  for (uint8_t i = 0; i < 64; i++) {
+    char c = p[i];
+    uint64_t bit = uint64_t(1) << i;
+    if (c == '"') m.quotes |= bit;
+    if (c == '\\') m.backslashes |= bit;
+    if (isStructural(c)) m.structurals |= bit;
+    if (isSpace(c)) m.spaces |= bit;
+    if (c == '/' || c == '\'') m.unsupported |= bit;
+    if (c == '\0') {
+      m.terminators |= bit;
+      break;
+    }
+  }
+}
+
+#endif  // ARDUINOJSON_ENABLE_SIMD
+
+// Locates the tokens of a JSON document in RAM, 64 chars at a time.
+// The tokens are the structural chars outside of strings, the opening quotes
+// and the first char of each non-quoted string.
+// Like simdjson's first stage, it uses bitmasks to track the strings and the
+// escaped chars, but it scans the input lazily, so it needs no memory.
+// The scan stops at the first comment or single quote, see stopped().
+class StructuralIndex {
+ public:
+  explicit StructuralIndex(const char* input)
+      : _next(input - reinterpret_cast<uintptr_t>(input) % blockAlignment),
+        _block(_next),
+        _tokens(0),
+        _ignored(lowBits(size_t(input - _next))),
+        _inString(0),
+        _escaped(0),
+        _afterSeparator(1),
+        _done(false),
+        _stopped(false) {}
+
+  // Returns the position of the current token, or NULL at the end
+  const char* current() {
+    while (!_tokens && !_done) scanBlock();
+    return _tokens ? _block + countTrailingZeros(_tokens) : NULL;
+  }
+
+  // Moves to the next token.
+  // The input is scanned up to that token, so the chars before it can then be
+  // modified in place.
+  void move() {
+    _tokens &= _tokens - 1;
+    current();
+  }
+
+  // Tells whether the scan stopped at a comment or a single quote, which the
+  // bitmasks can't track. Once current() returns NULL, the rest of the input,
+  // from the end of the last token, must be read char by char.
+  bool stopped() const {
+    return _stopped;
+  }
+
+ private:
+  static uint64_t lowBits(size_t n) {
+    return (uint64_t(1) << n) - 1;
+  }
+
+  static uint64_t prefixXor(uint64_t bits) {
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return bits;
+  }
+
+  // Returns the chars that follow an odd number of backslashes
+  uint64_t findEscapedChars(uint64_t backslashes) {
+    const uint64_t evenBits = uint64_t(0x55555555) << 32 | 0x55555555;
+    backslashes &= ~_escaped;
+    uint64_t followsBackslash = backslashes << 1 | _escaped;
+    uint64_t oddStarts = backslashes & ~evenBits & ~followsBackslash;
+    uint64_t evenStarts = oddStarts + backslashes;
+    _escaped = evenStarts < backslashes ? 1 : 0;  // carry
+    return (evenBits ^ (evenStarts << 1)) & followsBackslash;
+  }
+
+  void scanBlock() {
+    BlockMasks m;
+    classifyBlock(_next, m);
+    _block = _next;
+    _next += 64;
+
+    // the chars before the input count as spaces
+    m.quotes &= ~_ignored;
+    m.backslashes &= ~_ignored;
+    m.structurals &= ~_ignored;
+    m.unsupported &= ~_ignored;
+    m.terminators &= ~_ignored;
+    m.spaces |= _ignored;
+    _ignored = 0;
+
+    // the chars after the terminator don't count
+    uint64_t valid = ~uint64_t(0);
+    if (m.terminators) {
+      valid = (m.terminators & (0 - m.terminators)) - 1;
+      _done = true;
+    }
+
+    uint64_t quotes = m.quotes & ~findEscapedChars(m.backslashes);
+    uint64_t inString = prefixXor(quotes) ^ _inString;  // opening included
+    _inString = 0 - (inString >> 63);
+    uint64_t strings = inString | quotes;
+    uint64_t structurals = m.structurals & ~strings;
+    uint64_t spaces = m.spaces & ~strings;
+
+    // a non-quoted string starts after a space, a structural or a string
+    uint64_t separators = structurals | spaces | (quotes & ~inString);
+    uint64_t afterSeparator = separators << 1 | _afterSeparator;
+    _afterSeparator = separators >> 63;
+    uint64_t nonQuoted = ~(strings | structurals | spaces) & afterSeparator;
+
+    // the tokens after a comment or a single quote are unreliable
+    uint64_t unsupported = m.unsupported & ~strings & valid;
+    if (unsupported) {
+      valid = (unsupported & (0 - unsupported)) - 1;
+      _done = true;
+      _stopped = true;
+    }
+
+    _tokens = (structurals | (quotes & inString) | nonQuoted) & valid;
+  }
+
+  const char* _next;   // the next block to scan
+  const char* _block;  // the block of _tokens
+  uint64_t _tokens;
+  uint64_t _ignored;         // the chars of the first block before the input
+  uint64_t _inString;        // all ones if the previous block ends in a string
+  uint64_t _escaped;         // 1 if the next block starts with an escaped char
+  uint64_t _afterSeparator;  // 1 if the previous block ends with a separator
+  bool _done;
+  bool _stopped;
+};
+}  // namespace Internals
+}  // namespace ArduinoJson
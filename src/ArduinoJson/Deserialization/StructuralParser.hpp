@@ -0,0 +1,104 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include "../DuplicateKeyPolicy.hpp"
+#include "../JsonBuffer.hpp"
+#include "../JsonVariant.hpp"
+#include "../Polyfills/attributes.hpp"
+#include "ParserStack.hpp"
+#include "StructuralIndex.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+template <typename TReader, typename TWriter>
+class JsonParser;
+
+// Parse a JSON string in RAM in two stages: StructuralIndex locates the
+// tokens, then the JsonArrays and JsonObjects are built from these tokens.
+// The result is identical to JsonParser: from the first comment or single
+// quote, which StructuralIndex doesn't support, the tokens are read char by
+// char, like JsonParser does.
+// Like JsonParser, it uses a ParserStack instead of recursion, so the native
+// stack usage doesn't depend on the nesting limit.
+// This internal class is not indended to be used directly.
+// Instead, define ARDUINOJSON_ENABLE_STRUCTURAL_PARSER to 1.
+template <typename TReader, typename TWriter>
+class StructuralParser {
+ public:
+  StructuralParser(JsonBuffer *buffer, TReader reader, TWriter writer,
+                   uint8_t nestingLimit, DuplicateKeyPolicy duplicateKeys)
+      : _buffer(buffer),
+        _reader(reader),
+        _writer(writer),
+        _index(reader.ptr()),
+        _nestingLimit(nestingLimit),
+        _duplicateKeys(duplicateKeys),
+        _end(reader.ptr()),
+        _stalled(false),
+        _slow(false) {}
+
+  JsonArray &parseArray();
+  JsonObject &parseObject();
+  JsonVariant parseVariant();
+
+ private:
+  StructuralParser &operator=(const StructuralParser &);  // non-copiable
+
+  // only used for addPair()
+  typedef JsonParser<TReader, TWriter> TreeParser;
+
+  // Returns the next token, or NULL at the end of the input.
+  // When the index stops, moves _reader to the end of the last token and
+  // continues with it.
+  inline const char *nextToken();
+  // Moves past the token returned by nextToken(), which is one char long
+  inline void skipToken();
+  // Moves past a string or a value that ends at end
+  inline void skipTo(const char *end);
+
+  bool eat(char charToSkip);
+
+  // Tells whether this char can follow a non-quoted string.
+  // If not, JsonParser fails on the next eat().
+  static bool endsToken(char c) {
+    return isSpace(c) || isStructural(c) || c == '\"' || c == '\0';
+  }
+
+  JsonArray &readArray();
+  JsonObject &readObject();
+  const char *readString();
+  bool readAnythingTo(JsonVariant *destination);
+
+  inline bool readArrayTo(JsonVariant *destination);
+  inline bool readObjectTo(JsonVariant *destination);
+  inline bool readStringTo(JsonVariant *destination);
+
+  // Reads the elements of an array or the members of an object, including
+  // the nested ones, after the opening bracket.
+  inline bool readContent(void *root, bool isObject);
+
+  // Adds a value to the array or the object of the frame.
+  // Returns false if there is not enough memory, or if the key is a rejected
+  // duplicate.
+  FORCE_INLINE bool addValue(ParserStack::Frame &, const char *key,
+                             const JsonVariant &value);
+
+  JsonBuffer *_buffer;
+  TReader _reader;
+  TWriter _writer;
+  StructuralIndex _index;
+  uint8_t _nestingLimit;
+  DuplicateKeyPolicy _duplicateKeys;
+  // The end of the last token
+  const char *_end;
+  // Set when a non-quoted string is followed by a char that isn't a token
+  bool _stalled;
+  // Set when the tokens are read from _reader instead of _index
+  bool _slow;
+};
+}  // namespace Internals
+}  // namespace ArduinoJson
@@ -0,0 +1,282 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include "JsonParserImpl.hpp"
+#include "StructuralParser.hpp"
+
+template <typename TReader, typename TWriter>
+inline ArduinoJson::JsonArray &
+ArduinoJson::Internals::StructuralParser<TReader, TWriter>::parseArray() {
+  return readArray();
+}
+
+template <typename TReader, typename TWriter>
+inline ArduinoJson::JsonObject &
+ArduinoJson::Internals::StructuralParser<TReader, TWriter>::parseObject() {
+  return readObject();
+}
+
+template <typename TReader, typename TWriter>
+inline ArduinoJson::JsonVariant
+ArduinoJson::Internals::StructuralParser<TReader, TWriter>::parseVariant() {
+  JsonVariant result;
+  readAnythingTo(&result);
+  return result;
+}
+
+template <typename TReader, typename TWriter>
+inline const char *
+ArduinoJson::Internals::StructuralParser<TReader, TWriter>::nextToken() {
+  if (!_slow) {
+    const char *token = _index.current();
+    if (token || !_index.stopped()) return token;
+    _slow = true;
+    _reader.skip(size_t(_end - _reader.ptr()));
+  }
+  skipSpacesAndComments(_reader);
+  return _reader.ptr();
+}
+
+template <typename TReader, typename TWriter>
+inline void
+ArduinoJson::Internals::StructuralParser<TReader, TWriter>::skipToken() {
+  if (_slow) {
+    _reader.move();
+  } else {
+    _end = _index.current() + 1;
+    _index.move();
+  }
+}
+
+template <typename TReader, typename TWriter>
+inline void ArduinoJson::Internals::StructuralParser<TReader, TWriter>::skipTo(
+    const char *end) {
+  if (_slow)
+    _reader.skip(size_t(end - _reader.ptr()));
+  else
+    _end = end;
+}
+
+template <typename TReader, typename TWriter>
+inline bool ArduinoJson::Internals::StructuralParser<TReader, TWriter>::eat(
+    char charToSkip) {
+  const char *token = nextToken();
+  if (!token || *token != charToSkip) return false;
+  // the reader stops right after the string, like JsonParser
+  if (_stalled && !_slow) return false;
+  skipToken();
+  return true;
+}
+
+template <typename TReader, typename TWriter>
+inline bool
+ArduinoJson::Internals::StructuralParser<TReader, TWriter>::readAnythingTo(
+    JsonVariant *destination) {
+  const char *token = nextToken();
+
+  switch (token ? *token : '\0') {
+    case '[':
+      return readArrayTo(destination);
+
+    case '{':
+      return readObjectTo(destination);
+
+    default:
+      return readStringTo(destination);
+  }
+}
+
+template <typename TReader, typename TWriter>
+inline ArduinoJson::JsonArray &
+ArduinoJson::Internals::StructuralParser<TReader, TWriter>::readArray() {
+  if (_nestingLimit == 0) return JsonArray::invalid();
+
+  // Create an empty array
+  JsonArray &array = _buffer->createArray();
+
+  // Check opening braket
+  if (!eat('[')) return JsonArray::invalid();
+
+  if (!readContent(&array, false)) return JsonArray::invalid();
+  return array;
+}
+
+template <typename TReader, typename TWriter>
+inline bool
+ArduinoJson::Internals::StructuralParser<TReader, TWriter>::readArrayTo(
+    JsonVariant *destination) {
+  JsonArray &array = readArray();
+  if (!array.success()) return false;
+
+  *destination = array;
+  return true;
+}
+
+template <typename TReader, typename TWriter>
+inline ArduinoJson::JsonObject &
+ArduinoJson::Internals::StructuralParser<TReader, TWriter>::readObject() {
+  if (_nestingLimit == 0) return JsonObject::invalid();
+
+  // Create an empty object
+  JsonObject &object = _buffer->createObject();
+
+  // Check opening brace
+  if (!eat('{')) return JsonObject::invalid();
+
+  if (!readContent(&object, true)) return JsonObject::invalid();
+  return object;
+}
+
+template <typename TReader, typename TWriter>
+inline bool
+ArduinoJson::Internals::StructuralParser<TReader, TWriter>::readContent(
+    void *root, bool isObject) {
+  uint8_t remainingLevels = uint8_t(_nestingLimit - 1);
+  // the array or object being filled; the stack holds the enclosing ones
+  ParserStack::Frame current = {root, isObject, NULL, NULL};
+  ParserStack stack(_buffer);
+
+  // a closing bracket is allowed right after the opening one
+  bool closing = eat(isObject ? '}' : ']');
+
+  for (;;) {
+    if (!closing) {
+      // 1 - Parse key
+      const char *key = NULL;
+      if (current.isObject) {
+        key = readString();
+        if (!key) goto ERROR_INVALID_KEY;
+        if (!eat(':')) goto ERROR_MISSING_COLON;
+      }
+
+      // 2 - Go down into a nested array or object, it will be added when it's
+      // closed
+      const char *token = nextToken();
+      char c = token ? *token : '\0';
+      if (c == '[' || c == '{') {
+        if (remainingLevels == 0) goto ERROR_TOO_DEEP;
+        void *nested;
+        if (c == '[')
+          nested = &_buffer->createArray();
+        else
+          nested = &_buffer->createObject();
+        skipToken();
+        if (!stack.push(current)) goto ERROR_NO_MEMORY;
+        current.container = nested;
+        current.isObject = c == '{';
+        current.key = key;
+        remainingLevels--;
+        closing = eat(current.isObject ? '}' : ']');
+        continue;
+      }
+
+      // 3 - Parse value
+      JsonVariant value;
+      if (!readStringTo(&value)) goto ERROR_INVALID_VALUE;
+      if (!addValue(current, key, value)) goto ERROR_CANNOT_ADD;
+    }
+
+    // 4 - More values? Closing brackets go up until a comma is found
+    while (closing || eat(current.isObject ? '}' : ']')) {
+      closing = false;
+      if (stack.empty()) return true;
+      ParserStack::Frame closed = current;
+      current = stack.top();
+      stack.pop();
+      remainingLevels++;
+
+      // an invalid container means that the JsonBuffer was full
+      JsonVariant value;
+      if (closed.isObject)
+        value = *static_cast<JsonObject *>(closed.container);
+      else
+        value = *static_cast<JsonArray *>(closed.container);
+      if (!value.success()) goto ERROR_NO_MEMORY;
+      if (!addValue(current, closed.key, value)) goto ERROR_CANNOT_ADD;
+    }
+    if (!eat(',')) goto ERROR_MISSING_COMMA;
+  }
+
+ERROR_INVALID_KEY:
+ERROR_INVALID_VALUE:
+ERROR_MISSING_COLON:
+ERROR_MISSING_COMMA:
+ERROR_NO_MEMORY:
+ERROR_CANNOT_ADD:
+ERROR_TOO_DEEP:
+  return false;
+}
+
+template <typename TReader, typename TWriter>
+inline bool
+ArduinoJson::Internals::StructuralParser<TReader, TWriter>::addValue(
+    ParserStack::Frame &frame, const char *key, const JsonVariant &value) {
+  if (!frame.isObject)
+    return static_cast<JsonArray *>(frame.container)->add(value);
+  return TreeParser::addPair(*static_cast<JsonObject *>(frame.container), key,
+                             value, _duplicateKeys) == TreeParser::PAIR_ADDED;
+}
+
+template <typename TReader, typename TWriter>
+inline bool
+ArduinoJson::Internals::StructuralParser<TReader, TWriter>::readObjectTo(
+    JsonVariant *destination) {
+  JsonObject &object = readObject();
+  if (!object.success()) return false;
+
+  *destination = object;
+  return true;
+}
+
+template <typename TReader, typename TWriter>
+inline const char *
+ArduinoJson::Internals::StructuralParser<TReader, TWriter>::readString() {
+  typename RemoveReference<TWriter>::type::String str = _writer.startString();
+
+  // a structural char means an empty string, like in JsonParser
+  const char *token = nextToken();
+  if (!token || isStructural(*token)) return str.c_str();
+
+  // the string may be modified in place, so the index must go past it first
+  if (!_slow) _index.move();
+
+  CharPointerTraits<char>::Reader reader(token);
+  if (isQuote(*token)) {
+    readQuotedString(reader, str);
+  } else {
+    readNonQuotedString(reader, str);
+    _stalled = !endsToken(reader.current());
+  }
+  skipTo(reader.ptr());
+
+  return str.c_str();
+}
+
+template <typename TReader, typename TWriter>
+inline bool
+ArduinoJson::Internals::StructuralParser<TReader, TWriter>::readStringTo(
+    JsonVariant *destination) {
+  const char *token = nextToken();
+  bool hasQuotes = token && isQuote(*token);
+#if ARDUINOJSON_ENABLE_EAGER_TYPING
+  if (token && !hasQuotes && !isStructural(*token)) {
+    if (!_slow) _index.move();
+    CharPointerTraits<char>::Reader reader(token);
+    if (!readNonQuotedValue(reader, _writer, destination)) return false;
+    _stalled = !endsToken(reader.current());
+    skipTo(reader.ptr());
+    return true;
+  }
+#endif
+  const char *value = readString();
+  if (value == NULL) return false;
+  if (hasQuotes) {
+    *destination = value;
+  } else {
+    *destination = RawJson(value);
+  }
+  return true;
+}
@@ -0,0 +1,17 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+namespace ArduinoJson {
+
+// Tells the parser what to do when a key appears twice in the same object.
+// Every policy but DUPLICATE_KEYS_KEEP_ALL requires a lookup for each key.
+enum DuplicateKeyPolicy {
+  DUPLICATE_KEYS_KEEP_LAST,   // the last value replaces the previous ones
+  DUPLICATE_KEYS_KEEP_FIRST,  // the following values are ignored
+  DUPLICATE_KEYS_KEEP_ALL,    // all pairs are appended without any lookup
+  DUPLICATE_KEYS_REJECT       // parsing fails
+};
+}
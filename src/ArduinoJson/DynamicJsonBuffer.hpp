@@ -79,6 +79,27 @@ class DynamicJsonBufferBase
     _head = 0;
   }
 
+  // Resets the buffer, like clear(), but keeps the largest block, so that
+  // the next documents of the same size don't need any allocation.
+  // USE WITH CAUTION: this invalidates all previously allocated data
+  void recycle() {
+    Block* largest = _head;
+    for (Block* b = _head; b; b = b->next) {
+      if (b->capacity > largest->capacity) largest = b;
+    }
+    Block* currentBlock = _head;
+    while (currentBlock != NULL) {
+      Block* nextBlock = currentBlock->next;
+      if (currentBlock != largest) _allocator.deallocate(currentBlock);
+      currentBlock = nextBlock;
+    }
+    if (largest) {
+      largest->next = NULL;
+      largest->size = 0;
+    }
+    _head = largest;
+  }
+
   class String {
    public:
     String(DynamicJsonBufferBase* parent)
@@ -99,6 +120,21 @@ class DynamicJsonBufferBase
       _length++;
     }
 
+    void append(const char* s, size_t n) {
+      if (_parent->canAllocInHead(n)) {
+        char* end = static_cast<char*>(_parent->allocInHead(n));
+        memcpy(end, s, n);
+        if (_length == 0) _start = end;
+      } else {
+        char* newStart =
+            static_cast<char*>(_parent->allocInNewBlock(_length + n));
+        if (_start && newStart) memcpy(newStart, _start, _length);
+        if (newStart) memcpy(newStart + _length, s, n);
+        _start = newStart;
+      }
+      _length += n;
+    }
+
     const char* c_str() {
       append(0);
       return _start;
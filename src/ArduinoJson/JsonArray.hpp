@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include "Data/ElementIndex.hpp"
 #include "Data/JsonBufferAllocated.hpp"
+#include "Data/LengthCache.hpp"
 #include "Data/List.hpp"
 #include "Data/ReferenceType.hpp"
 #include "Data/ValueSaver.hpp"
@@ -107,14 +109,14 @@ class JsonArray : public Internals::JsonPrintable<JsonArray>,
   // Gets the value at the specified index.
   template <typename T>
   typename Internals::JsonVariantAs<T>::type get(size_t index) const {
-    const_iterator it = begin() += index;
+    const_iterator it = iteratorAt(index);
     return it != end() ? it->as<T>() : Internals::JsonVariantDefault<T>::get();
   }
 
   // Check the type of the value at specified index.
   template <typename T>
   bool is(size_t index) const {
-    const_iterator it = begin() += index;
+    const_iterator it = iteratorAt(index);
     return it != end() ? it->is<T>() : false;
   }
 
@@ -127,10 +129,29 @@ class JsonArray : public Internals::JsonPrintable<JsonArray>,
   JsonObject &createNestedObject();
 
   // Removes element at specified index.
+  // This walks the list, even when the element index is enabled.
   void remove(size_t index) {
-    remove(begin() += index);
+    remove(iteratorAt(index));
   }
-  using Internals::List<JsonVariant>::remove;
+  void remove(iterator it) {
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+    if (_index.isBuilt()) _index.remove(it);
+#endif
+    Internals::List<JsonVariant>::remove(it);
+  }
+
+#if ARDUINOJSON_ENABLE_LENGTH_CACHE
+  // Returns the length of the JSON output.
+  // The result is remembered until a JsonArray or a JsonObject of the
+  // JsonBuffer is modified.
+  size_t measureLength() const {
+    size_t length;
+    if (_lengthCache.get(_buffer, length)) return length;
+    length = Internals::JsonPrintable<JsonArray>::measureLength();
+    _lengthCache.set(_buffer, length);
+    return length;
+  }
+#endif
 
   // Returns a reference an invalid JsonArray.
   // This object is meant to replace a NULL pointer.
@@ -201,10 +222,33 @@ class JsonArray : public Internals::JsonPrintable<JsonArray>,
 #endif
 
  private:
+  // Returns the element at the specified index, or end()
+  iterator iteratorAt(size_t index) {
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+    if (updateIndex()) return index < size() ? _index.at(index) : end();
+#endif
+    return begin() += index;
+  }
+  const_iterator iteratorAt(size_t index) const {
+    return const_cast<JsonArray *>(this)->iteratorAt(index);
+  }
+
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+  // Builds the element index if the array is large enough and the index is
+  // missing or out of sync (for example if the List was modified directly).
+  // Returns false if the array must be walked.
+  bool updateIndex() {
+    if (size() < ARDUINOJSON_ARRAY_INDEX_THRESHOLD) return false;
+    if (_index.isBuilt() && _index.size() == size()) return true;
+    return _index.build(_buffer, begin(), end(), size());
+  }
+#endif
+
   template <typename TValueRef>
   bool set_impl(size_t index, TValueRef value) {
-    iterator it = begin() += index;
+    iterator it = iteratorAt(index);
     if (it == end()) return false;
+    touch();
     return Internals::ValueSaver<TValueRef>::save(_buffer, *it, value);
   }
 
@@ -212,8 +256,19 @@ class JsonArray : public Internals::JsonPrintable<JsonArray>,
   bool add_impl(TValueRef value) {
     iterator it = Internals::List<JsonVariant>::add();
     if (it == end()) return false;
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+    if (_index.isBuilt()) _index.add(_buffer, it);
+#endif
     return Internals::ValueSaver<TValueRef>::save(_buffer, *it, value);
   }
+
+#if ARDUINOJSON_ENABLE_LENGTH_CACHE
+  mutable Internals::LengthCache _lengthCache;
+#endif
+
+#if ARDUINOJSON_ENABLE_ARRAY_INDEX
+  Internals::ElementIndex<iterator> _index;
+#endif
 };
 
 namespace Internals {
@@ -8,6 +8,7 @@
 #include <stdint.h>  // for uint8_t
 #include <string.h>
 
+#include "Configuration.hpp"
 #include "Data/NonCopyable.hpp"
 #include "JsonVariant.hpp"
 #include "TypeTraits/EnableIf.hpp"
@@ -59,7 +60,26 @@ class JsonBuffer : Internals::NonCopyable {
   // Return a pointer to the allocated memory or NULL if allocation fails.
   virtual void *alloc(size_t size) = 0;
 
+#if ARDUINOJSON_ENABLE_LENGTH_CACHE
+  // Returns a number that changes each time a JsonArray or a JsonObject
+  // allocated in this JsonBuffer is modified.
+  // It tells JsonArray::measureLength() and JsonObject::measureLength() if
+  // the length they remember is still valid.
+  size_t revision() const {
+    return _revision;
+  }
+
+  // Signals that a JsonArray or a JsonObject of this JsonBuffer was modified
+  void touch() {
+    _revision++;
+  }
+#endif
+
  protected:
+#if ARDUINOJSON_ENABLE_LENGTH_CACHE
+  JsonBuffer() : _revision(1) {}
+#endif
+
   // CAUTION: NO VIRTUAL DESTRUCTOR!
   // If we add a virtual constructor the Arduino compiler will add malloc()
   // and free() to the binary, adding 706 useless bytes.
@@ -74,5 +94,10 @@ class JsonBuffer : Internals::NonCopyable {
     return bytes;
 #endif
   }
+
+#if ARDUINOJSON_ENABLE_LENGTH_CACHE
+ private:
+  size_t _revision;
+#endif
 };
 }
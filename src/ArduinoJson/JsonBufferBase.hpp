@@ -19,6 +19,8 @@ class JsonBufferBase : public JsonBuffer {
   //
   // The second argument set the nesting limit
   //
+  // The third argument tells what to do with duplicate keys
+  //
   // Returns a reference to the new JsonObject or JsonObject::invalid() if the
   // allocation fails.
   // With this overload, the JsonBuffer will make a copy of the string
@@ -29,24 +31,69 @@ class JsonBufferBase : public JsonBuffer {
   typename Internals::EnableIf<!Internals::IsArray<TString>::value,
                                JsonArray &>::type
   parseArray(const TString &json,
-             uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
-    return Internals::makeParser(that(), json, nestingLimit).parseArray();
+             uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT,
+             DuplicateKeyPolicy duplicateKeys = DUPLICATE_KEYS_KEEP_LAST) {
+    return Internals::makeParser(that(), json, nestingLimit, duplicateKeys)
+        .parseArray();
   }
   //
   // JsonArray& parseArray(TString);
   // TString = const char*, const char[N], const FlashStringHelper*
   template <typename TString>
   JsonArray &parseArray(
-      TString *json, uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
-    return Internals::makeParser(that(), json, nestingLimit).parseArray();
+      TString *json, uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT,
+      DuplicateKeyPolicy duplicateKeys = DUPLICATE_KEYS_KEEP_LAST) {
+    return Internals::makeParser(that(), json, nestingLimit, duplicateKeys)
+        .parseArray();
   }
   //
   // JsonArray& parseArray(TString);
   // TString = std::istream&, Stream&
   template <typename TString>
   JsonArray &parseArray(
-      TString &json, uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
-    return Internals::makeParser(that(), json, nestingLimit).parseArray();
+      TString &json, uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT,
+      DuplicateKeyPolicy duplicateKeys = DUPLICATE_KEYS_KEEP_LAST) {
+    return Internals::makeParser(that(), json, nestingLimit, duplicateKeys)
+        .parseArray();
+  }
+
+  // Same as above, but only stores the values selected by the filter.
+  //
+  // JsonArray& parseArray(TString, const JsonFilter&);
+  // TString = const std::string&, const String&
+  template <typename TString>
+  typename Internals::EnableIf<!Internals::IsArray<TString>::value,
+                               JsonArray &>::type
+  parseArray(const TString &json, const JsonFilter &filter,
+             uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT,
+             DuplicateKeyPolicy duplicateKeys = DUPLICATE_KEYS_KEEP_LAST) {
+    return Internals::makeFilteredParser(that(), json, filter, nestingLimit,
+                                         duplicateKeys)
+        .parseArray();
+  }
+  //
+  // JsonArray& parseArray(TString, const JsonFilter&);
+  // TString = const char*, const char[N], const FlashStringHelper*
+  template <typename TString>
+  JsonArray &parseArray(
+      TString *json, const JsonFilter &filter,
+      uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT,
+      DuplicateKeyPolicy duplicateKeys = DUPLICATE_KEYS_KEEP_LAST) {
+    return Internals::makeFilteredParser(that(), json, filter, nestingLimit,
+                                         duplicateKeys)
+        .parseArray();
+  }
+  //
+  // JsonArray& parseArray(TString, const JsonFilter&);
+  // TString = std::istream&, Stream&
+  template <typename TString>
+  JsonArray &parseArray(
+      TString &json, const JsonFilter &filter,
+      uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT,
+      DuplicateKeyPolicy duplicateKeys = DUPLICATE_KEYS_KEEP_LAST) {
+    return Internals::makeFilteredParser(that(), json, filter, nestingLimit,
+                                         duplicateKeys)
+        .parseArray();
   }
 
   // Allocates and populate a JsonObject from a JSON string.
@@ -57,6 +104,8 @@ class JsonBufferBase : public JsonBuffer {
   //
   // The second argument set the nesting limit
   //
+  // The third argument tells what to do with duplicate keys
+  //
   // Returns a reference to the new JsonObject or JsonObject::invalid() if the
   // allocation fails.
   //
@@ -66,24 +115,69 @@ class JsonBufferBase : public JsonBuffer {
   typename Internals::EnableIf<!Internals::IsArray<TString>::value,
                                JsonObject &>::type
   parseObject(const TString &json,
-              uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
-    return Internals::makeParser(that(), json, nestingLimit).parseObject();
+              uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT,
+              DuplicateKeyPolicy duplicateKeys = DUPLICATE_KEYS_KEEP_LAST) {
+    return Internals::makeParser(that(), json, nestingLimit, duplicateKeys)
+        .parseObject();
   }
   //
   // JsonObject& parseObject(TString);
   // TString = const char*, const char[N], const FlashStringHelper*
   template <typename TString>
   JsonObject &parseObject(
-      TString *json, uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
-    return Internals::makeParser(that(), json, nestingLimit).parseObject();
+      TString *json, uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT,
+      DuplicateKeyPolicy duplicateKeys = DUPLICATE_KEYS_KEEP_LAST) {
+    return Internals::makeParser(that(), json, nestingLimit, duplicateKeys)
+        .parseObject();
   }
   //
   // JsonObject& parseObject(TString);
   // TString = std::istream&, Stream&
   template <typename TString>
   JsonObject &parseObject(
-      TString &json, uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
-    return Internals::makeParser(that(), json, nestingLimit).parseObject();
+      TString &json, uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT,
+      DuplicateKeyPolicy duplicateKeys = DUPLICATE_KEYS_KEEP_LAST) {
+    return Internals::makeParser(that(), json, nestingLimit, duplicateKeys)
+        .parseObject();
+  }
+
+  // Same as above, but only stores the values selected by the filter.
+  //
+  // JsonObject& parseObject(TString, const JsonFilter&);
+  // TString = const std::string&, const String&
+  template <typename TString>
+  typename Internals::EnableIf<!Internals::IsArray<TString>::value,
+                               JsonObject &>::type
+  parseObject(const TString &json, const JsonFilter &filter,
+              uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT,
+              DuplicateKeyPolicy duplicateKeys = DUPLICATE_KEYS_KEEP_LAST) {
+    return Internals::makeFilteredParser(that(), json, filter, nestingLimit,
+                                         duplicateKeys)
+        .parseObject();
+  }
+  //
+  // JsonObject& parseObject(TString, const JsonFilter&);
+  // TString = const char*, const char[N], const FlashStringHelper*
+  template <typename TString>
+  JsonObject &parseObject(
+      TString *json, const JsonFilter &filter,
+      uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT,
+      DuplicateKeyPolicy duplicateKeys = DUPLICATE_KEYS_KEEP_LAST) {
+    return Internals::makeFilteredParser(that(), json, filter, nestingLimit,
+                                         duplicateKeys)
+        .parseObject();
+  }
+  //
+  // JsonObject& parseObject(TString, const JsonFilter&);
+  // TString = std::istream&, Stream&
+  template <typename TString>
+  JsonObject &parseObject(
+      TString &json, const JsonFilter &filter,
+      uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT,
+      DuplicateKeyPolicy duplicateKeys = DUPLICATE_KEYS_KEEP_LAST) {
+    return Internals::makeFilteredParser(that(), json, filter, nestingLimit,
+                                         duplicateKeys)
+        .parseObject();
   }
 
   // Generalized version of parseArray() and parseObject(), also works for
@@ -95,24 +189,69 @@ class JsonBufferBase : public JsonBuffer {
   typename Internals::EnableIf<!Internals::IsArray<TString>::value,
                                JsonVariant>::type
   parse(const TString &json,
-        uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
-    return Internals::makeParser(that(), json, nestingLimit).parseVariant();
+        uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT,
+        DuplicateKeyPolicy duplicateKeys = DUPLICATE_KEYS_KEEP_LAST) {
+    return Internals::makeParser(that(), json, nestingLimit, duplicateKeys)
+        .parseVariant();
   }
   //
   // JsonVariant parse(TString);
   // TString = const char*, const char[N], const FlashStringHelper*
   template <typename TString>
-  JsonVariant parse(TString *json,
-                    uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
-    return Internals::makeParser(that(), json, nestingLimit).parseVariant();
+  JsonVariant parse(
+      TString *json, uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT,
+      DuplicateKeyPolicy duplicateKeys = DUPLICATE_KEYS_KEEP_LAST) {
+    return Internals::makeParser(that(), json, nestingLimit, duplicateKeys)
+        .parseVariant();
   }
   //
   // JsonVariant parse(TString);
   // TString = std::istream&, Stream&
   template <typename TString>
-  JsonVariant parse(TString &json,
-                    uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT) {
-    return Internals::makeParser(that(), json, nestingLimit).parseVariant();
+  JsonVariant parse(
+      TString &json, uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT,
+      DuplicateKeyPolicy duplicateKeys = DUPLICATE_KEYS_KEEP_LAST) {
+    return Internals::makeParser(that(), json, nestingLimit, duplicateKeys)
+        .parseVariant();
+  }
+
+  // Same as above, but only stores the values selected by the filter.
+  //
+  // JsonVariant parse(TString, const JsonFilter&);
+  // TString = const std::string&, const String&
+  template <typename TString>
+  typename Internals::EnableIf<!Internals::IsArray<TString>::value,
+                               JsonVariant>::type
+  parse(const TString &json, const JsonFilter &filter,
+        uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT,
+        DuplicateKeyPolicy duplicateKeys = DUPLICATE_KEYS_KEEP_LAST) {
+    return Internals::makeFilteredParser(that(), json, filter, nestingLimit,
+                                         duplicateKeys)
+        .parseVariant();
+  }
+  //
+  // JsonVariant parse(TString, const JsonFilter&);
+  // TString = const char*, const char[N], const FlashStringHelper*
+  template <typename TString>
+  JsonVariant parse(
+      TString *json, const JsonFilter &filter,
+      uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT,
+      DuplicateKeyPolicy duplicateKeys = DUPLICATE_KEYS_KEEP_LAST) {
+    return Internals::makeFilteredParser(that(), json, filter, nestingLimit,
+                                         duplicateKeys)
+        .parseVariant();
+  }
+  //
+  // JsonVariant parse(TString, const JsonFilter&);
+  // TString = std::istream&, Stream&
+  template <typename TString>
+  JsonVariant parse(
+      TString &json, const JsonFilter &filter,
+      uint8_t nestingLimit = ARDUINOJSON_DEFAULT_NESTING_LIMIT,
+      DuplicateKeyPolicy duplicateKeys = DUPLICATE_KEYS_KEEP_LAST) {
+    return Internals::makeFilteredParser(that(), json, filter, nestingLimit,
+                                         duplicateKeys)
+        .parseVariant();
   }
 
  protected:
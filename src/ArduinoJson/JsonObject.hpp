@@ -5,6 +5,8 @@
 #pragma once
 
 #include "Data/JsonBufferAllocated.hpp"
+#include "Data/KeyIndex.hpp"
+#include "Data/LengthCache.hpp"
 #include "Data/List.hpp"
 #include "Data/ReferenceType.hpp"
 #include "Data/ValueSaver.hpp"
@@ -29,6 +31,8 @@ class JsonBuffer;
 namespace Internals {
 template <typename>
 class JsonObjectSubscript;
+template <typename TReader, typename TWriter>
+class JsonParser;
 }
 
 // A dictionary of JsonVariant indexed by string (char*)
@@ -42,6 +46,9 @@ class JsonObject : public Internals::JsonPrintable<JsonObject>,
                    public Internals::NonCopyable,
                    public Internals::List<JsonPair>,
                    public Internals::JsonBufferAllocated {
+  template <typename TReader, typename TWriter>
+  friend class Internals::JsonParser;
+
  public:
   // Create an empty JsonArray attached to the specified JsonBuffer.
   // You should not use this constructor directly.
@@ -251,7 +258,25 @@ class JsonObject : public Internals::JsonPrintable<JsonObject>,
   }
   //
   // void remove(iterator)
-  using Internals::List<JsonPair>::remove;
+  void remove(iterator it) {
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+    if (_index.isBuilt()) _index.remove(it);
+#endif
+    Internals::List<JsonPair>::remove(it);
+  }
+
+#if ARDUINOJSON_ENABLE_LENGTH_CACHE
+  // Returns the length of the JSON output.
+  // The result is remembered until a JsonArray or a JsonObject of the
+  // JsonBuffer is modified.
+  size_t measureLength() const {
+    size_t length;
+    if (_lengthCache.get(_buffer, length)) return length;
+    length = Internals::JsonPrintable<JsonObject>::measureLength();
+    _lengthCache.set(_buffer, length);
+    return length;
+  }
+#endif
 
   // Returns a reference an invalid JsonObject.
   // This object is meant to replace a NULL pointer.
@@ -265,6 +290,9 @@ class JsonObject : public Internals::JsonPrintable<JsonObject>,
   // Returns the list node that matches the specified key.
   template <typename TStringRef>
   iterator findKey(TStringRef key) {
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+    if (updateIndex()) return _index.find<TStringRef>(key);
+#endif
     iterator it;
     for (it = begin(); it != end(); ++it) {
       if (Internals::StringTraits<TStringRef>::equals(key, it->key)) break;
@@ -276,6 +304,17 @@ class JsonObject : public Internals::JsonPrintable<JsonObject>,
     return const_cast<JsonObject*>(this)->findKey<TStringRef>(key);
   }
 
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+  // Builds the key index if the object is large enough and the index is
+  // missing or out of sync (for example if the List was modified directly).
+  // Returns false if the object must be searched linearly.
+  bool updateIndex() {
+    if (size() < ARDUINOJSON_OBJECT_INDEX_THRESHOLD) return false;
+    if (_index.isBuilt() && _index.size() == size()) return true;
+    return _index.build(_buffer, begin(), end(), size());
+  }
+#endif
+
   template <typename TStringRef, typename TValue>
   typename Internals::JsonVariantAs<TValue>::type get_impl(
       TStringRef key) const {
@@ -291,14 +330,29 @@ class JsonObject : public Internals::JsonPrintable<JsonObject>,
 
     // search a matching key
     iterator it = findKey<TStringRef>(key);
-    if (it == end()) {
-      // add the key
-      it = Internals::List<JsonPair>::add();
-      if (it == end()) return false;
-      bool key_ok =
-          Internals::ValueSaver<TStringRef>::save(_buffer, it->key, key);
-      if (!key_ok) return false;
-    }
+    if (it == end()) return append_impl<TStringRef, TValueRef>(key, value);
+
+    // save the value
+    touch();
+    return Internals::ValueSaver<TValueRef>::save(_buffer, it->value, value);
+  }
+
+  // Adds a key-value pair without checking if the key is already present.
+  // Used by set_impl() and by the parser when duplicate keys are allowed.
+  template <typename TStringRef, typename TValueRef>
+  bool append_impl(TStringRef key, TValueRef value) {
+    // ignore null key
+    if (Internals::StringTraits<TStringRef>::is_null(key)) return false;
+
+    // add the key
+    iterator it = Internals::List<JsonPair>::add();
+    if (it == end()) return false;
+    bool key_ok =
+        Internals::ValueSaver<TStringRef>::save(_buffer, it->key, key);
+    if (!key_ok) return false;
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+    if (_index.isBuilt()) _index.insert(_buffer, it);
+#endif
 
     // save the value
     return Internals::ValueSaver<TValueRef>::save(_buffer, it->value, value);
@@ -315,6 +369,14 @@ class JsonObject : public Internals::JsonPrintable<JsonObject>,
 
   template <typename TStringRef>
   JsonObject& createNestedObject_impl(TStringRef key);
+
+#if ARDUINOJSON_ENABLE_LENGTH_CACHE
+  mutable Internals::LengthCache _lengthCache;
+#endif
+
+#if ARDUINOJSON_ENABLE_OBJECT_INDEX
+  Internals::KeyIndex<iterator> _index;
+#endif
 };
 
 namespace Internals {
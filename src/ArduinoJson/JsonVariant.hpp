@@ -28,6 +28,9 @@ namespace ArduinoJson {
 // Forward declarations.
 class JsonArray;
 class JsonObject;
+namespace Internals {
+class JsonWalker;
+}
 
 // A variant that can be a any value serializable to a JSON value.
 //
@@ -39,6 +42,7 @@ class JsonObject;
 class JsonVariant : public Internals::JsonVariantBase<JsonVariant> {
   template <typename Print>
   friend class Internals::JsonSerializer;
+  friend class Internals::JsonWalker;
 
  public:
   // Creates an uninitialized JsonVariant
@@ -0,0 +1,76 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include "../Configuration.hpp"
+
+#if ARDUINOJSON_ENABLE_SIMD
+
+#include <stddef.h>  // for size_t
+#include <stdint.h>  // for uint32_t
+
+#include "./attributes.hpp"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#else
+#include <emmintrin.h>
+#endif
+
+namespace ArduinoJson {
+namespace Internals {
+
+// The blocks are always loaded from an aligned address, so a load never
+// crosses a page boundary and never faults, even if it reads past the
+// terminator. The bytes before the start of the string are masked out.
+#ifdef __AVX2__
+struct SimdBlock {
+  static const size_t size = 32;
+  static const uint32_t allBits = 0xFFFFFFFF;
+
+  __m256i value;
+
+  NO_SANITIZE_ADDRESS explicit SimdBlock(const char* p)
+      : value(_mm256_load_si256(reinterpret_cast<const __m256i*>(p))) {}
+
+  uint32_t equals(char c) const {
+    __m256i eq = _mm256_cmpeq_epi8(value, _mm256_set1_epi8(c));
+    return static_cast<uint32_t>(_mm256_movemask_epi8(eq));
+  }
+
+  // Returns the chars from 0x00 to 0x1F
+  uint32_t controlChars() const {
+    __m256i min = _mm256_min_epu8(value, _mm256_set1_epi8(0x1F));
+    __m256i eq = _mm256_cmpeq_epi8(min, value);
+    return static_cast<uint32_t>(_mm256_movemask_epi8(eq));
+  }
+};
+#else
+struct SimdBlock {
+  static const size_t size = 16;
+  static const uint32_t allBits = 0xFFFF;
+
+  __m128i value;
+
+  NO_SANITIZE_ADDRESS explicit SimdBlock(const char* p)
+      : value(_mm_load_si128(reinterpret_cast<const __m128i*>(p))) {}
+
+  uint32_t equals(char c) const {
+    __m128i eq = _mm_cmpeq_epi8(value, _mm_set1_epi8(c));
+    return static_cast<uint32_t>(_mm_movemask_epi8(eq));
+  }
+
+  // Returns the chars from 0x00 to 0x1F
+  uint32_t controlChars() const {
+    __m128i min = _mm_min_epu8(value, _mm_set1_epi8(0x1F));
+    __m128i eq = _mm_cmpeq_epi8(min, value);
+    return static_cast<uint32_t>(_mm_movemask_epi8(eq));
+  }
+};
+#endif
+}  // namespace Internals
+}  // namespace ArduinoJson
+
+#endif  // ARDUINOJSON_ENABLE_SIMD
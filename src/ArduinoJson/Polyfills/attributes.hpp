@@ -8,12 +8,19 @@
 
 #define FORCE_INLINE  // __forceinline causes C4714 when returning std::string
 #define NO_INLINE __declspec(noinline)
+#define NO_SANITIZE_ADDRESS
 #define DEPRECATED(msg) __declspec(deprecated(msg))
 
 #elif defined(__GNUC__)  // GCC or Clang
 
 #define FORCE_INLINE __attribute__((always_inline))
 #define NO_INLINE __attribute__((noinline))
+#if defined(__clang__) || __GNUC__ > 4 || \
+    (__GNUC__ == 4 && __GNUC_MINOR__ >= 8)
+#define NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#else
+#define NO_SANITIZE_ADDRESS
+#endif
 #if __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 5)
 #define DEPRECATED(msg) __attribute__((deprecated(msg)))
 #else
@@ -24,6 +31,7 @@
 
 #define FORCE_INLINE
 #define NO_INLINE
+#define NO_SANITIZE_ADDRESS
 #define DEPRECATED(msg)
 
 #endif
@@ -0,0 +1,25 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <stdint.h>
+
+namespace ArduinoJson {
+namespace Internals {
+
+inline uint8_t countLeadingZeros(uint64_t x) {
+#ifdef __GNUC__
+  return static_cast<uint8_t>(__builtin_clzll(x));
+#else
+  uint8_t n = 0;
+  while (!(x >> 63)) {
+    x <<= 1;
+    n++;
+  }
+  return n;
+#endif
+}
+}  // namespace Internals
+}  // namespace ArduinoJson
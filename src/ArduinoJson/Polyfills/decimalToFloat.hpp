@@ -0,0 +1,314 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <stdint.h>
+
+#include "../TypeTraits/FloatTraits.hpp"
+#include "./countLeadingZeros.hpp"
+#include "./ctype.hpp"
+#include "./fullMultiplication.hpp"
+#include "./powerOfFive.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+// Multiplies w by 5^q, keeping enough significant bits
+inline UInt128 multiplyByPowerOfFive(uint64_t w, int16_t q, uint8_t precision) {
+  const uint32_t* p = powerOfFive(q);
+  UInt128 result = fullMultiplication(w, uint64_t(p[0]) << 32 | p[1]);
+  uint64_t mask = ~uint64_t(0) >> precision;
+  if ((result.high & mask) == mask) {
+    // the lower part of the power of five may carry into the significant bits
+    UInt128 low = fullMultiplication(w, uint64_t(p[2]) << 32 | p[3]);
+    result.low += low.high;
+    if (low.high > result.low) result.high++;
+  }
+  return result;
+}
+
+// The binary representation of a float: the explicit bits of the mantissa
+// and the biased exponent
+struct AdjustedMantissa {
+  uint64_t mantissa;
+  int32_t power2;
+
+  bool operator!=(const AdjustedMantissa& other) const {
+    return mantissa != other.mantissa || power2 != other.power2;
+  }
+};
+
+// Rounds w * 10^q to the nearest float with the Eisel-Lemire algorithm.
+// The 128-bit approximation of 5^q is always sufficient, see
+// "Fast Number Parsing Without Fallback" by Noble Mushtak and Daniel Lemire.
+template <typename T>
+AdjustedMantissa computeFloat(int32_t q, uint64_t w) {
+  typedef FloatTraits<T> traits;
+  const int32_t mantissaBits = traits::mantissa_bits;
+  const int32_t infinitePower = 2 * traits::exponent_bias + 1;
+
+  AdjustedMantissa answer;
+  answer.mantissa = 0;
+  answer.power2 = 0;
+  if (w == 0 || q < traits::smallest_power_of_ten) return answer;
+  if (q > traits::largest_power_of_ten) {
+    answer.power2 = infinitePower;
+    return answer;
+  }
+
+  uint8_t lz = countLeadingZeros(w);
+  w <<= lz;
+  UInt128 product = multiplyByPowerOfFive(w, int16_t(q),
+                                          uint8_t(mantissaBits + 3));
+  int32_t upperBit = int32_t(product.high >> 63);
+  int32_t shift = upperBit + 64 - mantissaBits - 3;
+  answer.mantissa = product.high >> shift;
+  // (217706 * q) >> 16 is floor(log2(10^q)) for the range of q
+  int32_t power2 = ((217706 * q) >> 16) + 63 + upperBit - lz;
+
+  if (power2 < 1 - traits::exponent_bias) {  // subnormal
+    uint32_t subnormalShift = uint32_t(1 - traits::exponent_bias - power2);
+    if (subnormalShift >= 64) {
+      answer.mantissa = 0;
+      answer.power2 = 0;
+      return answer;
+    }
+    answer.mantissa >>= subnormalShift;
+    answer.mantissa += (answer.mantissa & 1);
+    answer.mantissa >>= 1;
+    answer.power2 =
+        answer.mantissa < (uint64_t(1) << mantissaBits) ? 0 : 1;
+    return answer;
+  }
+  answer.power2 = power2 + traits::exponent_bias;
+
+  // a product exactly halfway between two floats is rounded to even
+  if (product.low <= 1 && q >= traits::min_exponent_round_to_even &&
+      q <= traits::max_exponent_round_to_even &&
+      (answer.mantissa & 3) == 1 &&
+      (answer.mantissa << shift) == product.high) {
+    answer.mantissa &= ~uint64_t(1);
+  }
+
+  answer.mantissa += (answer.mantissa & 1);
+  answer.mantissa >>= 1;
+  if (answer.mantissa >= (uint64_t(2) << mantissaBits)) {
+    answer.mantissa = uint64_t(1) << mantissaBits;
+    answer.power2++;
+  }
+  answer.mantissa &= ~(uint64_t(1) << mantissaBits);
+  if (answer.power2 >= infinitePower) {
+    answer.mantissa = 0;
+    answer.power2 = infinitePower;
+  }
+  return answer;
+}
+
+// A fixed-size unsigned integer, large enough to compare a decimal number of
+// maxDecimalDigits digits with a halfway point between two doubles
+class BigUInt {
+ public:
+  explicit BigUInt(uint64_t value) : _size(0) {
+    while (value) {
+      _words[_size++] = uint32_t(value);
+      value >>= 32;
+    }
+  }
+
+  void multiplyAdd(uint32_t factor, uint32_t addend) {
+    uint64_t carry = addend;
+    for (size_t i = 0; i < _size; i++) {
+      uint64_t product = uint64_t(_words[i]) * factor + carry;
+      _words[i] = uint32_t(product);
+      carry = product >> 32;
+    }
+    if (carry && _size < capacity) _words[_size++] = uint32_t(carry);
+  }
+
+  void multiplyByPowerOfFive(uint32_t n) {
+    for (; n >= 13; n -= 13) multiplyAdd(1220703125, 0);  // 5^13
+    uint32_t factor = 1;
+    while (n--) factor *= 5;
+    multiplyAdd(factor, 0);
+  }
+
+  void shiftLeft(uint32_t n) {
+    if (_size == 0) return;
+    size_t words = n / 32;
+    uint32_t bits = n % 32;
+    if (_size + words + 1 > capacity) return;  // can't happen
+    _words[_size + words] = 0;
+    for (size_t i = _size; i-- > 0;) {
+      if (bits) _words[i + words + 1] |= _words[i] >> (32 - bits);
+      _words[i + words] = _words[i] << bits;
+    }
+    for (size_t i = 0; i < words; i++) _words[i] = 0;
+    _size += words + 1;
+    if (_words[_size - 1] == 0) _size--;
+  }
+
+  int compare(const BigUInt& other) const {
+    if (_size != other._size) return _size < other._size ? -1 : 1;
+    for (size_t i = _size; i-- > 0;) {
+      if (_words[i] != other._words[i])
+        return _words[i] < other._words[i] ? -1 : 1;
+    }
+    return 0;
+  }
+
+  // a halfway point between two doubles has at most 767 significant digits
+  static const size_t maxDecimalDigits = 768;
+
+ private:
+  static const size_t capacity = 128;  // 4096 bits
+  uint32_t _words[capacity];
+  size_t _size;
+};
+
+// Rounds the decimal number starting at s, when w * 10^q is too close to a
+// halfway point between two floats: the decimal number is compared to the
+// halfway point above lower, using big integers.
+// The 19 significant digits of w are the beginning of s.
+template <typename T>
+AdjustedMantissa roundWithAllDigits(const char* s, int32_t q,
+                                    AdjustedMantissa lower) {
+  typedef FloatTraits<T> traits;
+  const int32_t mantissaBits = traits::mantissa_bits;
+
+  // read up to maxDecimalDigits significant digits
+  BigUInt digits(0);
+  size_t count = 0;
+  uint32_t chunk = 0, chunkScale = 1;
+  bool truncated = false;
+  for (; isdigit(*s) || *s == '.'; s++) {
+    if (*s == '.') continue;
+    if (count == 0 && *s == '0') continue;
+    if (count == BigUInt::maxDecimalDigits) {
+      if (*s != '0') truncated = true;
+      continue;
+    }
+    chunk = chunk * 10 + uint32_t(*s - '0');
+    chunkScale *= 10;
+    count++;
+    if (chunkScale == 1000000000) {
+      digits.multiplyAdd(chunkScale, chunk);
+      chunk = 0;
+      chunkScale = 1;
+    }
+  }
+  digits.multiplyAdd(chunkScale, chunk);
+  int32_t exponent10 = q - int32_t(count - 19);
+
+  // halfway = (2 * mantissa + 1) * 2^(exponent2 - 1)
+  uint64_t mantissa = lower.mantissa;
+  int32_t exponent2 = 1 - traits::exponent_bias - mantissaBits;
+  if (lower.power2 > 0) {
+    mantissa |= uint64_t(1) << mantissaBits;
+    exponent2 += lower.power2 - 1;
+  }
+  BigUInt halfway(2 * mantissa + 1);
+  exponent2--;
+
+  // compare digits * 10^exponent10 with halfway * 2^exponent2
+  if (exponent10 >= 0)
+    digits.multiplyByPowerOfFive(uint32_t(exponent10));
+  else
+    halfway.multiplyByPowerOfFive(uint32_t(-exponent10));
+  if (exponent10 > exponent2)
+    digits.shiftLeft(uint32_t(exponent10 - exponent2));
+  else
+    halfway.shiftLeft(uint32_t(exponent2 - exponent10));
+  int cmp = digits.compare(halfway);
+
+  if (cmp < 0 || (cmp == 0 && !truncated && (mantissa & 1) == 0))
+    return lower;
+
+  AdjustedMantissa upper = lower;
+  upper.mantissa++;
+  if (upper.mantissa == uint64_t(1) << mantissaBits) {
+    upper.mantissa = 0;
+    upper.power2++;
+  }
+  return upper;
+}
+
+// Converts the decimal number at s to a float.
+// The sign must have been read.
+template <typename T>
+T decimalToFloat(const char* s) {
+  typedef FloatTraits<T> traits;
+
+  const char* digits = s;
+  uint64_t mantissa = 0;  // the first 19 significant digits
+  uint8_t mantissaDigits = 0;
+  int32_t exponent = 0;
+  bool truncated = false;
+
+  for (; isdigit(*s); s++) {
+    if (mantissaDigits < 19) {
+      mantissa = mantissa * 10 + uint8_t(*s - '0');
+      if (mantissa) mantissaDigits++;
+    } else {
+      exponent++;
+      if (*s != '0') truncated = true;
+    }
+  }
+
+  if (*s == '.') {
+    s++;
+    for (; isdigit(*s); s++) {
+      if (mantissaDigits < 19) {
+        mantissa = mantissa * 10 + uint8_t(*s - '0');
+        if (mantissa) mantissaDigits++;
+        exponent--;
+      } else {
+        if (*s != '0') truncated = true;
+      }
+    }
+  }
+
+  if (*s == 'e' || *s == 'E') {
+    s++;
+    bool negativeExponent = false;
+    if (*s == '-') {
+      negativeExponent = true;
+      s++;
+    } else if (*s == '+') {
+      s++;
+    }
+
+    int32_t explicitExponent = 0;
+    for (; isdigit(*s); s++) {
+      if (explicitExponent < 100000)
+        explicitExponent = explicitExponent * 10 + (*s - '0');
+    }
+    exponent += negativeExponent ? -explicitExponent : explicitExponent;
+  }
+
+  if (mantissa == 0) return 0;
+
+  // Clinger's fast path: both numbers are exact, so is the result
+#if !defined(__FLT_EVAL_METHOD__) || __FLT_EVAL_METHOD__ == 0
+  if (!truncated && mantissa >> (traits::mantissa_bits + 1) == 0 &&
+      exponent >= -traits::max_exact_power_of_ten &&
+      exponent <= traits::max_exact_power_of_ten) {
+    T value = T(mantissa);
+    if (exponent < 0)
+      return value / traits::exactPowerOfTen(-exponent);
+    else
+      return value * traits::exactPowerOfTen(exponent);
+  }
+#endif
+
+  AdjustedMantissa result = computeFloat<T>(exponent, mantissa);
+  // with more than 19 digits, the result must be the same with w and w + 1
+  if (truncated && result != computeFloat<T>(exponent, mantissa + 1))
+    result = roundWithAllDigits<T>(digits, exponent, result);
+
+  return traits::fromBits(result.mantissa |
+                          uint64_t(result.power2) << traits::mantissa_bits);
+}
+}  // namespace Internals
+}  // namespace ArduinoJson
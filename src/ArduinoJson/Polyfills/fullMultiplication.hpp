@@ -0,0 +1,37 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <stdint.h>
+
+namespace ArduinoJson {
+namespace Internals {
+
+struct UInt128 {
+  uint64_t high;
+  uint64_t low;
+};
+
+inline UInt128 fullMultiplication(uint64_t a, uint64_t b) {
+  UInt128 result;
+#if defined(__GNUC__) && defined(__SIZEOF_INT128__)
+  __extension__ typedef unsigned __int128 uint128_t;
+  uint128_t product = uint128_t(a) * b;
+  result.high = uint64_t(product >> 64);
+  result.low = uint64_t(product);
+#else
+  uint64_t aLow = a & 0xFFFFFFFF, aHigh = a >> 32;
+  uint64_t bLow = b & 0xFFFFFFFF, bHigh = b >> 32;
+  uint64_t lowLow = aLow * bLow;
+  uint64_t highLow = aHigh * bLow;
+  uint64_t lowHigh = aLow * bHigh;
+  uint64_t cross = (lowLow >> 32) + (highLow & 0xFFFFFFFF) + lowHigh;
+  result.high = aHigh * bHigh + (highLow >> 32) + (cross >> 32);
+  result.low = (cross << 32) | (lowLow & 0xFFFFFFFF);
+#endif
+  return result;
+}
+}  // namespace Internals
+}  // namespace ArduinoJson
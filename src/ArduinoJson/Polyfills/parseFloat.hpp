@@ -4,18 +4,21 @@
 
 #pragma once
 
+#include "../Configuration.hpp"
 #include "../TypeTraits/FloatTraits.hpp"
 #include "./ctype.hpp"
 #include "./math.hpp"
 
+#if ARDUINOJSON_ENABLE_PRECISE_FLOAT_PARSING
+#include "./decimalToFloat.hpp"
+#endif
+
 namespace ArduinoJson {
 namespace Internals {
 
 template <typename T>
 inline T parseFloat(const char* s) {
   typedef FloatTraits<T> traits;
-  typedef typename traits::mantissa_type mantissa_t;
-  typedef typename traits::exponent_type exponent_t;
 
   if (!s) return 0;  // NULL
 
@@ -35,6 +38,12 @@ inline T parseFloat(const char* s) {
   if (*s == 'i' || *s == 'I')
     return negative_result ? -traits::inf() : traits::inf();
 
+#if ARDUINOJSON_ENABLE_PRECISE_FLOAT_PARSING
+  T result = decimalToFloat<T>(s);
+#else
+  typedef typename traits::mantissa_type mantissa_t;
+  typedef typename traits::exponent_type exponent_t;
+
   mantissa_t mantissa = 0;
   exponent_t exponent_offset = 0;
 
@@ -84,6 +93,8 @@ inline T parseFloat(const char* s) {
 
   T result = traits::make_float(static_cast<T>(mantissa), exponent);
 
+#endif
+
   return negative_result ? -result : result;
 }
 }
@@ -0,0 +1,84 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <stddef.h>  // for size_t
+
+#include "../TypeTraits/EnableIf.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+// A meta-function that returns true if the Print implementation has a member
+// function size_t write(const char*, size_t), like Arduino's Print class.
+template <typename TPrint>
+class HasBulkWrite {
+ protected:  // <- to avoid GCC's "all member functions in class are private"
+  typedef char Yes[1];
+  typedef char No[2];
+
+  template <typename T, size_t (T::*)(const char *, size_t)>
+  struct Signature {};
+
+  template <typename T>
+  static Yes &probe(Signature<T, &T::write> *);
+  template <typename T>
+  static No &probe(...);
+
+ public:
+  enum { value = sizeof(probe<TPrint>(0)) == sizeof(Yes) };
+};
+
+// Sends n chars to the Print implementation, in one call if possible.
+template <typename TPrint>
+typename EnableIf<HasBulkWrite<TPrint>::value, size_t>::type bulkWrite(
+    TPrint &print, const char *s, size_t n) {
+  return print.write(s, n);
+}
+
+template <typename TPrint>
+typename EnableIf<!HasBulkWrite<TPrint>::value, size_t>::type bulkWrite(
+    TPrint &print, const char *s, size_t n) {
+  size_t result = 0;
+  while (n--) result += print.print(*s++);
+  return result;
+}
+
+// A meta-function that returns true if the Print implementation has a member
+// function size_t writeReference(const char*, size_t), i.e. if it can keep a
+// pointer to the chars instead of copying them, like JsonSegmentBuilder.
+template <typename TPrint>
+class HasWriteReference {
+ protected:  // <- to avoid GCC's "all member functions in class are private"
+  typedef char Yes[1];
+  typedef char No[2];
+
+  template <typename T, size_t (T::*)(const char *, size_t)>
+  struct Signature {};
+
+  template <typename T>
+  static Yes &probe(Signature<T, &T::writeReference> *);
+  template <typename T>
+  static No &probe(...);
+
+ public:
+  enum { value = sizeof(probe<TPrint>(0)) == sizeof(Yes) };
+};
+
+// Sends n chars that remain valid until the end of the serialization, by
+// reference if possible.
+template <typename TPrint>
+typename EnableIf<HasWriteReference<TPrint>::value, size_t>::type
+writeReference(TPrint &print, const char *s, size_t n) {
+  return print.writeReference(s, n);
+}
+
+template <typename TPrint>
+typename EnableIf<!HasWriteReference<TPrint>::value, size_t>::type
+writeReference(TPrint &print, const char *s, size_t n) {
+  return bulkWrite(print, s, n);
+}
+}
+}
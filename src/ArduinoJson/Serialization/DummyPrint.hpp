@@ -17,6 +17,10 @@ class DummyPrint {
   size_t print(const char* s) {
     return strlen(s);
   }
+
+  size_t write(const char*, size_t n) {
+    return n;
+  }
 };
 }
 }
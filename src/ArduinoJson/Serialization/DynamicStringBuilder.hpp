@@ -26,6 +26,12 @@ class DynamicStringBuilder {
     return _str.length() - initialLen;
   }
 
+  size_t write(const char *s, size_t n) {
+    size_t initialLen = _str.length();
+    StringTraits<TString>::append(_str, s, n);
+    return _str.length() - initialLen;
+  }
+
  private:
   DynamicStringBuilder &operator=(const DynamicStringBuilder &);
 
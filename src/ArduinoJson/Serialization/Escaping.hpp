@@ -0,0 +1,50 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <stddef.h>  // for size_t
+#include <stdint.h>  // for uint32_t, uintptr_t
+
+#include "../Configuration.hpp"
+#include "../Data/Encoding.hpp"
+#include "../Polyfills/SimdBlock.hpp"
+#include "../Polyfills/attributes.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+#if ARDUINOJSON_ENABLE_SIMD
+
+// Returns the number of characters at the beginning of s that can be written
+// as is in a JSON string.
+// It stops on the control chars, the quote, the backslash and the terminator;
+// some control chars don't need to be escaped, see Encoding::escapeChar().
+NO_SANITIZE_ADDRESS inline size_t countUnescapedChars(const char* s) {
+  size_t offset = reinterpret_cast<uintptr_t>(s) % SimdBlock::size;
+  const char* p = s - offset;
+  for (;;) {
+    SimdBlock block(p);
+    uint32_t stops =
+        block.controlChars() | block.equals('\"') | block.equals('\\');
+    stops = stops >> offset << offset;
+    if (stops) return size_t(p - s) + size_t(__builtin_ctz(stops));
+    p += SimdBlock::size;
+    offset = 0;
+  }
+}
+
+#else  // ARDUINOJSON_ENABLE_SIMD
+
+// Returns the number of characters at the beginning of s that can be written
+// as is in a JSON string
+inline size_t countUnescapedChars(const char* s) {
+  const char* p = s;
+  while (*p && !Encoding::escapeChar(*p)) p++;
+  return size_t(p - s);
+}
+
+#endif  // ARDUINOJSON_ENABLE_SIMD
+}  // namespace Internals
+}  // namespace ArduinoJson
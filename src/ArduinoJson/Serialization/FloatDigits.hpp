@@ -0,0 +1,296 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <stdint.h>
+
+#include "../Polyfills/countLeadingZeros.hpp"
+#include "../Polyfills/fullMultiplication.hpp"
+#include "../TypeTraits/FloatTraits.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+// A floating point number with a 64-bit mantissa: f * 2^e
+struct DiyFp {
+  uint64_t f;
+  int e;
+
+  DiyFp(uint64_t f_, int e_) : f(f_), e(e_) {}
+
+  DiyFp operator-(const DiyFp &other) const {
+    return DiyFp(f - other.f, e);
+  }
+
+  // Returns the upper 64 bits of the product, rounded
+  DiyFp operator*(const DiyFp &other) const {
+    UInt128 product = fullMultiplication(f, other.f);
+    return DiyFp(product.high + (product.low >> 63), e + other.e + 64);
+  }
+
+  DiyFp normalized() const {
+    uint8_t shift = countLeadingZeros(f);
+    return DiyFp(f << shift, e - shift);
+  }
+};
+
+// 10^decimalExponent ~= (high * 2^32 + low) * 2^binaryExponent
+struct CachedPowerOfTen {
+  uint32_t high;
+  uint32_t low;
+  int16_t binaryExponent;
+  int16_t decimalExponent;
+};
+
+// Returns a power of ten c such that the binary exponent of w * c is between
+// -60 and -32, as required by Grisu.
+inline const CachedPowerOfTen &cachedPowerOfTen(int binaryExponent) {
+  static const CachedPowerOfTen powers[] = {
+      {0xAB70FE17, 0xC79AC6CA, -1060, -300},
+      {0xFF77B1FC, 0xBEBCDC4F, -1034, -292},
+      {0xBE5691EF, 0x416BD60C, -1007, -284},
+      {0x8DD01FAD, 0x907FFC3C, -980, -276},
+      {0xD3515C28, 0x31559A83, -954, -268},
+      {0x9D71AC8F, 0xADA6C9B5, -927, -260},
+      {0xEA9C2277, 0x23EE8BCB, -901, -252},
+      {0xAECC4991, 0x4078536D, -874, -244},
+      {0x823C1279, 0x5DB6CE57, -847, -236},
+      {0xC2109436, 0x4DFB5637, -821, -228},
+      {0x9096EA6F, 0x3848984F, -794, -220},
+      {0xD77485CB, 0x25823AC7, -768, -212},
+      {0xA086CFCD, 0x97BF97F4, -741, -204},
+      {0xEF340A98, 0x172AACE5, -715, -196},
+      {0xB23867FB, 0x2A35B28E, -688, -188},
+      {0x84C8D4DF, 0xD2C63F3B, -661, -180},
+      {0xC5DD4427, 0x1AD3CDBA, -635, -172},
+      {0x936B9FCE, 0xBB25C996, -608, -164},
+      {0xDBAC6C24, 0x7D62A584, -582, -156},
+      {0xA3AB6658, 0x0D5FDAF6, -555, -148},
+      {0xF3E2F893, 0xDEC3F126, -529, -140},
+      {0xB5B5ADA8, 0xAAFF80B8, -502, -132},
+      {0x87625F05, 0x6C7C4A8B, -475, -124},
+      {0xC9BCFF60, 0x34C13053, -449, -116},
+      {0x964E858C, 0x91BA2655, -422, -108},
+      {0xDFF97724, 0x70297EBD, -396, -100},
+      {0xA6DFBD9F, 0xB8E5B88F, -369, -92},
+      {0xF8A95FCF, 0x88747D94, -343, -84},
+      {0xB9447093, 0x8FA89BCF, -316, -76},
+      {0x8A08F0F8, 0xBF0F156B, -289, -68},
+      {0xCDB02555, 0x653131B6, -263, -60},
+      {0x993FE2C6, 0xD07B7FAC, -236, -52},
+      {0xE45C10C4, 0x2A2B3B06, -210, -44},
+      {0xAA242499, 0x697392D3, -183, -36},
+      {0xFD87B5F2, 0x8300CA0E, -157, -28},
+      {0xBCE50864, 0x92111AEB, -130, -20},
+      {0x8CBCCC09, 0x6F5088CC, -103, -12},
+      {0xD1B71758, 0xE219652C, -77, -4},
+      {0x9C400000, 0x00000000, -50, 4},
+      {0xE8D4A510, 0x00000000, -24, 12},
+      {0xAD78EBC5, 0xAC620000, 3, 20},
+      {0x813F3978, 0xF8940984, 30, 28},
+      {0xC097CE7B, 0xC90715B3, 56, 36},
+      {0x8F7E32CE, 0x7BEA5C70, 83, 44},
+      {0xD5D238A4, 0xABE98068, 109, 52},
+      {0x9F4F2726, 0x179A2245, 136, 60},
+      {0xED63A231, 0xD4C4FB27, 162, 68},
+      {0xB0DE6538, 0x8CC8ADA8, 189, 76},
+      {0x83C7088E, 0x1AAB65DB, 216, 84},
+      {0xC45D1DF9, 0x42711D9A, 242, 92},
+      {0x924D692C, 0xA61BE758, 269, 100},
+      {0xDA01EE64, 0x1A708DEA, 295, 108},
+      {0xA26DA399, 0x9AEF774A, 322, 116},
+      {0xF209787B, 0xB47D6B85, 348, 124},
+      {0xB454E4A1, 0x79DD1877, 375, 132},
+      {0x865B8692, 0x5B9BC5C2, 402, 140},
+      {0xC83553C5, 0xC8965D3D, 428, 148},
+      {0x952AB45C, 0xFA97A0B3, 455, 156},
+      {0xDE469FBD, 0x99A05FE3, 481, 164},
+      {0xA59BC234, 0xDB398C25, 508, 172},
+      {0xF6C69A72, 0xA3989F5C, 534, 180},
+      {0xB7DCBF53, 0x54E9BECE, 561, 188},
+      {0x88FCF317, 0xF22241E2, 588, 196},
+      {0xCC20CE9B, 0xD35C78A5, 614, 204},
+      {0x98165AF3, 0x7B2153DF, 641, 212},
+      {0xE2A0B5DC, 0x971F303A, 667, 220},
+      {0xA8D9D153, 0x5CE3B396, 694, 228},
+      {0xFB9B7CD9, 0xA4A7443C, 720, 236},
+      {0xBB764C4C, 0xA7A44410, 747, 244},
+      {0x8BAB8EEF, 0xB6409C1A, 774, 252},
+      {0xD01FEF10, 0xA657842C, 800, 260},
+      {0x9B10A4E5, 0xE9913129, 827, 268},
+      {0xE7109BFB, 0xA19C0C9D, 853, 276},
+      {0xAC2820D9, 0x623BF429, 880, 284},
+      {0x80444B5E, 0x7AA7CF85, 907, 292},
+      {0xBF21E440, 0x03ACDD2D, 933, 300},
+      {0x8E679C2F, 0x5E44FF8F, 960, 308},
+      {0xD433179D, 0x9C8CB841, 986, 316},
+      {0x9E19DB92, 0xB4E31BA9, 1013, 324},
+      {0xEB96BF6E, 0xBADF77D9, 1039, 332},
+      {0xAF87023B, 0x9BF0EE6B, 1066, 340}};
+  // the decimal exponents start at -300, with a step of 8
+  int f = -61 - binaryExponent;
+  int k = f * 78913 / (1 << 18) + (f > 0 ? 1 : 0);  // ceil(f * log10(2))
+  return powers[(300 + k + 7) / 8];
+}
+
+// The shortest decimal representation of a positive float that parses back
+// to the same value: value = digits * 10^exponent.
+// The digits are computed with the Grisu2 algorithm from "Printing
+// Floating-Point Numbers Quickly and Accurately with Integers" by Florian
+// Loitsch. Grisu2 always returns a representation that round-trips; in rare
+// cases (about 0.1% of random doubles), it has one more digit than needed.
+template <typename TFloat>
+struct FloatDigits {
+  char digits[18];  // not null-terminated
+  int8_t length;
+  int16_t exponent;
+
+  FloatDigits(TFloat value) : length(0) {
+    typedef FloatTraits<TFloat> traits;
+    const int mantissaBits = traits::mantissa_bits;
+    const int minExponent = 1 - traits::exponent_bias - mantissaBits;
+    const uint64_t hiddenBit = uint64_t(1) << mantissaBits;
+
+    // decompose the value, compute the boundaries m- and m+ half-way to the
+    // neighbors
+    uint64_t bits = traits::toBits(value);
+    uint64_t biasedExponent = bits >> mantissaBits;
+    uint64_t fraction = bits & (hiddenBit - 1);
+    DiyFp v = biasedExponent == 0
+                  ? DiyFp(fraction, minExponent)
+                  : DiyFp(fraction + hiddenBit,
+                          int(biasedExponent) - 1 + minExponent);
+    bool lowerBoundaryIsCloser = fraction == 0 && biasedExponent > 1;
+    DiyFp plus = DiyFp(2 * v.f + 1, v.e - 1).normalized();
+    DiyFp minus = lowerBoundaryIsCloser ? DiyFp(4 * v.f - 1, v.e - 2)
+                                        : DiyFp(2 * v.f - 1, v.e - 1);
+    minus.f <<= minus.e - plus.e;
+    minus.e = plus.e;
+    v = v.normalized();
+
+    // scale by a cached power of ten
+    const CachedPowerOfTen &cached = cachedPowerOfTen(plus.e);
+    DiyFp c(uint64_t(cached.high) << 32 | cached.low, cached.binaryExponent);
+    DiyFp w = v * c;
+    DiyFp upper = plus * c;
+    DiyFp lower = minus * c;
+    upper.f--;
+    lower.f++;
+    exponent = int16_t(-cached.decimalExponent);
+
+    generateDigits(lower, w, upper);
+  }
+
+ private:
+  // Generates the digits of upper, until the number is between lower and upper
+  void generateDigits(DiyFp lower, DiyFp w, DiyFp upper) {
+    uint64_t delta = (upper - lower).f;
+    uint64_t distance = (upper - w).f;
+
+    // split upper into its integral part and its fractional part
+    int shift = -upper.e;
+    uint64_t one = uint64_t(1) << shift;
+    uint32_t integral = uint32_t(upper.f >> shift);
+    uint64_t fractional = upper.f & (one - 1);
+
+    int n = countDigits(integral);
+    while (n > 0) {
+      n--;
+      digits[length++] = char('0' + removeFirstDigit(integral, n));
+      uint64_t rest = (uint64_t(integral) << shift) + fractional;
+      if (rest <= delta) {
+        exponent = int16_t(exponent + n);
+        round(distance, delta, rest, uint64_t(powerOfTen(n)) << shift);
+        return;
+      }
+    }
+
+    for (;;) {
+      fractional *= 10;
+      digits[length++] = char('0' + (fractional >> shift));
+      fractional &= one - 1;
+      exponent--;
+      delta *= 10;
+      distance *= 10;
+      if (fractional <= delta) break;
+    }
+    round(distance, delta, fractional, one);
+  }
+
+  static uint32_t powerOfTen(int n) {
+    static const uint32_t powers[] = {
+        1,      10,      100,      1000,      10000,
+        100000, 1000000, 10000000, 100000000, 1000000000};
+    return powers[n];
+  }
+
+  static int countDigits(uint32_t value) {
+    int n = 1;
+    while (n < 10 && value >= powerOfTen(n)) n++;
+    return n;
+  }
+
+  // Returns value / 10^n and keeps value % 10^n, for value < 10^(n+1).
+  // The divisors are constants, so the compiler replaces the divisions by
+  // multiplications.
+  static uint32_t removeFirstDigit(uint32_t &value, int n) {
+    uint32_t digit;
+    switch (n) {
+      case 9:
+        digit = value / 1000000000;
+        value %= 1000000000;
+        break;
+      case 8:
+        digit = value / 100000000;
+        value %= 100000000;
+        break;
+      case 7:
+        digit = value / 10000000;
+        value %= 10000000;
+        break;
+      case 6:
+        digit = value / 1000000;
+        value %= 1000000;
+        break;
+      case 5:
+        digit = value / 100000;
+        value %= 100000;
+        break;
+      case 4:
+        digit = value / 10000;
+        value %= 10000;
+        break;
+      case 3:
+        digit = value / 1000;
+        value %= 1000;
+        break;
+      case 2:
+        digit = value / 100;
+        value %= 100;
+        break;
+      case 1:
+        digit = value / 10;
+        value %= 10;
+        break;
+      default:
+        digit = value;
+        value = 0;
+        break;
+    }
+    return digit;
+  }
+
+  // Decrements the last digit while it gets the result closer to w
+  void round(uint64_t distance, uint64_t delta, uint64_t rest, uint64_t tenK) {
+    while (rest < distance && delta - rest >= tenK &&
+           (rest + tenK < distance ||
+            distance - rest > rest + tenK - distance)) {
+      digits[length - 1]--;
+      rest += tenK;
+    }
+  }
+};
+}
+}
@@ -4,6 +4,10 @@
 
 #pragma once
 
+#include <string.h>  // for memchr, strlen
+
+#include "BulkWrite.hpp"
+
 namespace ArduinoJson {
 namespace Internals {
 
@@ -28,10 +32,22 @@ class IndentedPrint {
   }
 
   size_t print(const char *s) {
-    // TODO: optimize
-    size_t n = 0;
-    while (*s) n += print(*s++);
-    return n;
+    return write(s, strlen(s));
+  }
+
+  // Sends the chars to the sink in one call per line
+  size_t write(const char *s, size_t n) {
+    size_t result = 0;
+    while (n > 0) {
+      if (isNewLine) result += writeTabs();
+      const char *newLine = static_cast<const char *>(memchr(s, '\n', n));
+      size_t length = newLine ? size_t(newLine - s + 1) : n;
+      result += bulkWrite(*sink, s, length);
+      isNewLine = newLine != NULL;
+      s += length;
+      n -= length;
+    }
+    return result;
   }
 
   // Adds one level of indentation
@@ -46,23 +62,28 @@ class IndentedPrint {
 
   // Set the number of space printed for each level of indentation
   void setTabSize(uint8_t n) {
-    if (n < MAX_TAB_SIZE) tabSize = n & MAX_TAB_SIZE;
+    tabSize = n;
   }
 
  private:
   Print *sink;
-  uint8_t level : 4;
-  uint8_t tabSize : 3;
-  bool isNewLine : 1;
+  uint8_t level;
+  uint8_t tabSize;
+  bool isNewLine;
 
   size_t writeTabs() {
+    static const char spaces[] = "                ";  // 16 spaces
+    const size_t chunk = sizeof(spaces) - 1;
     size_t n = 0;
-    for (int i = 0; i < level * tabSize; i++) n += sink->print(' ');
+    for (size_t remaining = size_t(level) * tabSize; remaining > 0;) {
+      size_t length = remaining < chunk ? remaining : chunk;
+      n += bulkWrite(*sink, spaces, length);
+      remaining -= length;
+    }
     return n;
   }
 
-  static const int MAX_LEVEL = 15;    // because it's only 4 bits
-  static const int MAX_TAB_SIZE = 7;  // because it's only 3 bits
+  static const uint8_t MAX_LEVEL = 255;  // because it's only 8 bits
 };
 }
 }
@@ -0,0 +1,270 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <string.h>  // for memcpy, strlen
+
+#include "../Configuration.hpp"
+#include "../Data/Encoding.hpp"
+#include "Escaping.hpp"
+#include "JsonSerializer.hpp"
+#include "JsonWalker.hpp"
+#include "JsonWriter.hpp"
+
+namespace ArduinoJson {
+
+// Serializes a JsonArray, a JsonObject or a JsonVariant in chunks, so that a
+// large document can be sent with a small buffer, without measuring it first:
+//
+//   JsonChunkedSerializer<> serializer(root);
+//   char chunk[64];
+//   while (size_t n = serializer.read(chunk, sizeof(chunk))) send(chunk, n);
+//
+// The document must not be modified until the serialization is complete.
+// MAX_DEPTH is the maximum number of nested arrays and objects; if the
+// document is deeper, the output stops and failed() returns true.
+template <size_t MAX_DEPTH = ARDUINOJSON_DEFAULT_NESTING_LIMIT>
+class JsonChunkedSerializer {
+ public:
+  explicit JsonChunkedSerializer(const JsonArray &root)
+      : _walker(_stack, MAX_DEPTH) {
+    init();
+    _walker.start(root);
+  }
+
+  explicit JsonChunkedSerializer(const JsonObject &root)
+      : _walker(_stack, MAX_DEPTH) {
+    init();
+    _walker.start(root);
+  }
+
+  explicit JsonChunkedSerializer(const JsonVariant &root)
+      : _root(root), _walker(_stack, MAX_DEPTH) {
+    init();
+    _walker.start(_root);
+  }
+
+  // Writes the next part of the JSON document in the buffer.
+  // Returns the number of bytes written, which is less than size only when
+  // the end of the document is reached.
+  size_t read(char *buffer, size_t size) {
+    char *p = buffer;
+    char *end = buffer + size;
+    while (p < end) {
+      if (_pending < _pendingEnd) {
+        p = copy(p, end, _pending, _pendingEnd);
+      } else if (_string) {
+        p = writeString(p, end);
+      } else if (_number) {
+        writeNumber();
+      } else {
+        char *next = writeToken(p);
+        if (!next) break;
+        p = next;
+      }
+    }
+    return size_t(p - buffer);
+  }
+
+  // Returns true if the document was too deep to be serialized completely
+  bool failed() const {
+    return _failed;
+  }
+
+ private:
+  JsonChunkedSerializer(const JsonChunkedSerializer &);
+  JsonChunkedSerializer &operator=(const JsonChunkedSerializer &);
+
+  typedef Internals::JsonWalker Walker;
+
+  // A Print implementation that keeps the part of the output that starts at
+  // a given offset and fits in a buffer, and drops the rest.
+  class Window {
+   public:
+    Window(char *buffer, size_t size, size_t offset)
+        : _begin(buffer), _p(buffer), _end(buffer + size), _offset(offset) {}
+
+    size_t print(char c) {
+      return write(&c, 1);
+    }
+
+    size_t print(const char *s) {
+      return write(s, strlen(s));
+    }
+
+    // Returns n, as if everything was written, so that
+    // JsonWriter::bytesWritten() is the length of the whole output
+    size_t write(const char *s, size_t n) {
+      size_t skipped = n < _offset ? n : _offset;
+      size_t kept = n - skipped;
+      size_t room = size_t(_end - _p);
+      if (kept > room) kept = room;
+      memcpy(_p, s + skipped, kept);
+      _p += kept;
+      _offset -= skipped;
+      return n;
+    }
+
+    size_t size() const {
+      return size_t(_p - _begin);
+    }
+
+   private:
+    char *_begin;
+    char *_p;
+    char *_end;
+    size_t _offset;
+  };
+
+  typedef Internals::JsonWriter<Window> WindowWriter;
+
+  void init() {
+    _pending = _pendingEnd = NULL;
+    _string = _runEnd = NULL;
+    _number = NULL;
+    _numberOffset = 0;
+    _escape = false;
+    _isKey = false;
+    _failed = false;
+  }
+
+  // Copies as many chars as possible from [begin, end) to [p, pEnd)
+  static char *copy(char *p, char *pEnd, const char *&begin, const char *end) {
+    size_t n = size_t(end - begin);
+    size_t room = size_t(pEnd - p);
+    if (n > room) n = room;
+    memcpy(p, begin, n);
+    begin += n;
+    return p + n;
+  }
+
+  void setPending(const char *s, size_t n) {
+    _pending = s;
+    _pendingEnd = s + n;
+  }
+
+  // Writes the next punctuation, or starts the next string or number, which
+  // are written by the next iterations of read().
+  // Returns NULL at the end of the document.
+  char *writeToken(char *p) {
+    switch (_walker.next()) {
+      case Walker::TOKEN_BEGIN_ARRAY:
+        *p++ = '[';
+        return p;
+      case Walker::TOKEN_END_ARRAY:
+        *p++ = ']';
+        return p;
+      case Walker::TOKEN_BEGIN_OBJECT:
+        *p++ = '{';
+        return p;
+      case Walker::TOKEN_END_OBJECT:
+        *p++ = '}';
+        return p;
+      case Walker::TOKEN_COMMA:
+        *p++ = ',';
+        return p;
+      case Walker::TOKEN_KEY:
+        return startString(p, _walker.string(), true);
+      case Walker::TOKEN_STRING:
+        return startString(p, _walker.string(), false);
+      case Walker::TOKEN_RAW:
+        _string = _walker.string();
+        if (_string) _runEnd = _string + strlen(_string);
+        _escape = false;
+        return p;
+      case Walker::TOKEN_VALUE:
+        _number = &_walker.value();
+        _numberOffset = 0;
+        return p;
+      case Walker::TOKEN_ERROR:
+        _failed = true;
+        return NULL;
+      default:  // TOKEN_END
+        return NULL;
+    }
+  }
+
+  // Writes the next part of the current number in _scratch.
+  // A number is usually written at once, but a float can be longer than
+  // _scratch, because of the zeros added by the exponentiation thresholds;
+  // in that case, it's serialized again for each part.
+  void writeNumber() {
+    Window window(_scratch, sizeof(_scratch), _numberOffset);
+    WindowWriter writer(window);
+    Internals::JsonSerializer<WindowWriter>::serialize(*_number, writer);
+    setPending(_scratch, window.size());
+    _numberOffset += window.size();
+    if (_numberOffset >= writer.bytesWritten()) _number = NULL;
+  }
+
+  // A key is followed by a colon
+  char *startString(char *p, const char *s, bool isKey) {
+    if (!s) {
+      if (isKey)
+        setPending("null:", 5);
+      else
+        setPending("null", 4);
+      return p;
+    }
+    _isKey = isKey;
+    _string = s;
+    _runEnd = s + Internals::countUnescapedChars(s);
+    _escape = true;
+    *p++ = '\"';
+    return p;
+  }
+
+  // Writes the content of the current string, up to the next char to escape
+  char *writeString(char *p, char *end) {
+    if (_string < _runEnd) return copy(p, end, _string, _runEnd);
+
+    char c = *_string;
+    if (!_escape || !c) {
+      if (_escape) {
+        if (_isKey)
+          setPending("\":", 2);
+        else
+          setPending("\"", 1);
+      }
+      _string = NULL;
+      return p;
+    }
+    char specialChar = Internals::Encoding::escapeChar(c);
+    if (specialChar) {
+      _scratch[0] = '\\';
+      _scratch[1] = specialChar;
+      setPending(_scratch, 2);
+    } else {
+      _scratch[0] = c;
+      setPending(_scratch, 1);
+    }
+    _string++;
+    _runEnd = _string + Internals::countUnescapedChars(_string);
+    return p;
+  }
+
+  JsonVariant _root;
+  Internals::JsonWalkerFrame _stack[MAX_DEPTH];
+  Walker _walker;
+
+  // the chars to write before moving on
+  const char *_pending;
+  const char *_pendingEnd;
+
+  // the current string, and the end of the chars that don't need escaping
+  const char *_string;
+  const char *_runEnd;
+  bool _escape;
+  bool _isKey;
+
+  // the current number, and the length already written
+  const JsonVariant *_number;
+  size_t _numberOffset;
+
+  bool _failed;
+  // a part of a number, or an escape sequence
+  char _scratch[32];
+};
+}
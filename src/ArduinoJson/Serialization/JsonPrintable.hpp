@@ -11,7 +11,7 @@
 #include "IndentedPrint.hpp"
 #include "JsonSerializer.hpp"
 #include "JsonWriter.hpp"
-#include "Prettyfier.hpp"
+#include "PrettyJsonWriter.hpp"
 #include "StaticStringBuilder.hpp"
 
 #if ARDUINOJSON_ENABLE_STD_STREAM
@@ -61,10 +61,32 @@ class JsonPrintable {
     return printTo(sb);
   }
 
+#if ARDUINOJSON_ENABLE_STD_STRING
+  // Measures the output, and writes it directly in the string's storage.
+  // The length may come from the length cache, which misses the values
+  // modified through an iterator, so a longer output is written again.
+  size_t printTo(std::string &str) const {
+    size_t start = str.size();
+    size_t length = downcast().measureLength();
+    // + 1 to detect a longer output, + 1 for StaticStringBuilder's '\0'
+    str.resize(start + length + 2);
+    StaticStringBuilder sb(&str[start], length + 2);
+    size_t n = printTo(sb);
+    if (n > length) {
+      str.resize(start);
+      DynamicStringBuilder<std::string> dsb(str);
+      return printTo(dsb);
+    }
+    str.resize(start + n);
+    return n;
+  }
+#endif
+
   template <typename Print>
   size_t prettyPrintTo(IndentedPrint<Print> &print) const {
-    Prettyfier<Print> p(print);
-    return printTo(p);
+    PrettyJsonWriter<Print> writer(print);
+    JsonSerializer<PrettyJsonWriter<Print> >::serialize(downcast(), writer);
+    return writer.bytesWritten();
   }
 
   size_t prettyPrintTo(char *buffer, size_t bufferSize) const {
@@ -0,0 +1,110 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <stddef.h>  // for size_t
+#include <string.h>  // for memcpy, strlen
+
+namespace ArduinoJson {
+
+// A contiguous part of the JSON output.
+// It has the same layout as struct iovec on POSIX systems, so an array of
+// JsonSegment can be passed to writev().
+struct JsonSegment {
+  const char *data;
+  size_t length;
+};
+
+// A Print implementation that splits the JSON output in segments, so that it
+// can be sent with a scatter-gather function like writev(), without copying
+// the strings of the document.
+// The content of the strings is referenced by the segments, all the other
+// chars (punctuation, numbers, escape sequences and short strings) are copied
+// in the scratch buffer.
+// The segments are valid as long as the document and the scratch buffer are.
+//
+// Usage:
+//   JsonSegment segments[64];
+//   char scratch[256];
+//   JsonSegmentBuilder sb(segments, 64, scratch, sizeof(scratch));
+//   root.printTo(sb);
+//   writev(fd, reinterpret_cast<iovec *>(segments), int(sb.size()));
+class JsonSegmentBuilder {
+ public:
+  JsonSegmentBuilder(JsonSegment *segments, size_t capacity, char *scratch,
+                     size_t scratchSize)
+      : _segments(segments),
+        _capacity(capacity),
+        _size(0),
+        _scratch(scratch),
+        _scratchEnd(scratch + scratchSize),
+        _lastIsScratch(false) {}
+
+  // Returns the number of segments
+  size_t size() const {
+    return _size;
+  }
+
+  const JsonSegment *segments() const {
+    return _segments;
+  }
+
+  size_t print(char c) {
+    return write(&c, 1);
+  }
+
+  size_t print(const char *s) {
+    return write(s, strlen(s));
+  }
+
+  // Copies the chars in the scratch buffer
+  size_t write(const char *s, size_t n) {
+    if (!_lastIsScratch) {
+      if (_size == _capacity) return truncate();
+      JsonSegment segment = {_scratch, 0};
+      _segments[_size++] = segment;
+      _lastIsScratch = true;
+    }
+    size_t available = size_t(_scratchEnd - _scratch);
+    bool overflow = n > available;
+    if (overflow) n = available;
+    memcpy(_scratch, s, n);
+    _scratch += n;
+    _segments[_size - 1].length += n;
+    if (overflow) truncate();
+    return n;
+  }
+
+  // Adds a segment that points to the chars, which must outlive the segments.
+  // Short runs are copied, because a segment costs as much as a few chars.
+  size_t writeReference(const char *s, size_t n) {
+    if (n < minReferenceLength) return write(s, n);
+    if (_size == _capacity) return truncate();
+    JsonSegment segment = {s, n};
+    _segments[_size++] = segment;
+    _lastIsScratch = false;
+    return n;
+  }
+
+  static const size_t minReferenceLength = 16;
+
+ private:
+  JsonSegmentBuilder &operator=(const JsonSegmentBuilder &);
+
+  // Stops accepting chars, so that the segments are a prefix of the output
+  size_t truncate() {
+    _capacity = _size;
+    _scratchEnd = _scratch;
+    return 0;
+  }
+
+  JsonSegment *_segments;
+  size_t _capacity;
+  size_t _size;
+  char *_scratch;
+  char *_scratchEnd;
+  bool _lastIsScratch;
+};
+}
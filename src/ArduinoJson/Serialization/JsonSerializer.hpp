@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "../Configuration.hpp"
 #include "JsonWriter.hpp"
 
 namespace ArduinoJson {
@@ -27,6 +28,17 @@ class JsonSerializer {
   template <typename TKey>
   static void serialize(const JsonObjectSubscript<TKey> &, Writer &);
   static void serialize(const JsonVariant &, Writer &);
+
+ private:
+  // Number of nested arrays and objects that JsonWalker keeps in a local
+  // stack, besides the innermost one.
+  // A tree that the parser produced with the default nesting limit is
+  // serialized without any recursive call; a deeper one costs a call every
+  // stackSize levels.
+  static const size_t stackSize = ARDUINOJSON_DEFAULT_NESTING_LIMIT;
+
+  template <typename TRoot>
+  static void serializeTokens(const TRoot &, Writer &);
 };
 }
 }
@@ -10,23 +10,12 @@
 #include "../JsonObjectSubscript.hpp"
 #include "../JsonVariant.hpp"
 #include "JsonSerializer.hpp"
+#include "JsonWalker.hpp"
 
 template <typename Writer>
 inline void ArduinoJson::Internals::JsonSerializer<Writer>::serialize(
     const JsonArray& array, Writer& writer) {
-  writer.beginArray();
-
-  JsonArray::const_iterator it = array.begin();
-  while (it != array.end()) {
-    serialize(*it, writer);
-
-    ++it;
-    if (it == array.end()) break;
-
-    writer.writeComma();
-  }
-
-  writer.endArray();
+  serializeTokens(array, writer);
 }
 
 template <typename Writer>
@@ -38,21 +27,69 @@ inline void ArduinoJson::Internals::JsonSerializer<Writer>::serialize(
 template <typename Writer>
 inline void ArduinoJson::Internals::JsonSerializer<Writer>::serialize(
     const JsonObject& object, Writer& writer) {
-  writer.beginObject();
-
-  JsonObject::const_iterator it = object.begin();
-  while (it != object.end()) {
-    writer.writeString(it->key);
-    writer.writeColon();
-    serialize(it->value, writer);
-
-    ++it;
-    if (it == object.end()) break;
+  serializeTokens(object, writer);
+}
 
-    writer.writeComma();
+// Writes the tokens of the array or the object, including the nested ones.
+// An array or an object that doesn't fit in the stack of the walker is
+// written by a recursive call.
+// The walker is a local variable, so that it can stay in registers.
+template <typename Writer>
+template <typename TRoot>
+inline void ArduinoJson::Internals::JsonSerializer<Writer>::serializeTokens(
+    const TRoot& root, Writer& writer) {
+  JsonWalkerFrame stack[stackSize];
+  JsonWalker walker(stack, stackSize + 1);
+  walker.start(root);
+
+  for (;;) {
+    switch (walker.next()) {
+      case JsonWalker::TOKEN_BEGIN_ARRAY:
+        writer.beginArray();
+        break;
+
+      case JsonWalker::TOKEN_END_ARRAY:
+        writer.endArray();
+        break;
+
+      case JsonWalker::TOKEN_BEGIN_OBJECT:
+        writer.beginObject();
+        break;
+
+      case JsonWalker::TOKEN_END_OBJECT:
+        writer.endObject();
+        break;
+
+      case JsonWalker::TOKEN_COMMA:
+        writer.writeComma();
+        break;
+
+      case JsonWalker::TOKEN_KEY:
+        writer.writeString(walker.string());
+        writer.writeColon();
+        break;
+
+      case JsonWalker::TOKEN_STRING:
+        writer.writeString(walker.string());
+        break;
+
+      case JsonWalker::TOKEN_RAW:
+        writer.writeRaw(walker.string());
+        break;
+
+      case JsonWalker::TOKEN_VALUE:
+        serialize(walker.value(), writer);
+        break;
+
+      case JsonWalker::TOKEN_ERROR:
+        serialize(walker.value(), writer);
+        walker.skip();
+        break;
+
+      default:  // TOKEN_END
+        return;
+    }
   }
-
-  writer.endObject();
 }
 
 template <typename Writer>
@@ -0,0 +1,210 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include "../JsonArray.hpp"
+#include "../JsonObject.hpp"
+#include "../JsonVariant.hpp"
+#include "../Polyfills/attributes.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+// A JsonArray or a JsonObject that is being walked, and the position of the
+// next element
+struct JsonWalkerFrame {
+  JsonArray::const_iterator element;
+  JsonObject::const_iterator member;
+  bool isObject;
+  bool needsComma;
+};
+
+// Enumerates the JSON tokens of a tree of JsonArray, JsonObject and
+// JsonVariant, in the order of the output.
+// The position in the tree is kept in a stack of JsonWalkerFrame provided by
+// the caller, instead of the native stack, so the walk can be interrupted
+// after any token, and doesn't need a function call per nesting level.
+class JsonWalker {
+ public:
+  enum Token {
+    TOKEN_BEGIN_ARRAY,
+    TOKEN_END_ARRAY,
+    TOKEN_BEGIN_OBJECT,
+    TOKEN_END_OBJECT,
+    TOKEN_COMMA,
+    TOKEN_KEY,     // string() is the key, to write with the colon
+    TOKEN_STRING,  // string() is the value, can be NULL
+    TOKEN_RAW,     // string() is the unparsed value, to write as is
+    TOKEN_VALUE,   // value() is a number, a boolean or undefined
+    TOKEN_END,     // the whole tree has been walked
+    TOKEN_ERROR    // the tree is deeper than the stack, see skip()
+  };
+
+  // The stack holds the enclosing arrays and objects, so the caller must
+  // provide capacity - 1 frames to walk capacity levels.
+  JsonWalker(JsonWalkerFrame *stack, size_t capacity)
+      : _stack(stack),
+        _capacity(capacity),
+        _depth(0),
+        _state(STATE_DONE),
+        _value(NULL),
+        _array(NULL),
+        _object(NULL),
+        _string(NULL) {}
+
+  void start(const JsonVariant &root) {
+    _value = &root;
+    _depth = 0;
+    _state = STATE_VALUE;
+  }
+
+  // JsonArray::invalid() is written as [], so it's not converted to an
+  // undefined JsonVariant
+  void start(const JsonArray &root) {
+    _array = &root;
+    _depth = 0;
+    _state = STATE_ARRAY;
+  }
+
+  void start(const JsonObject &root) {
+    _object = &root;
+    _depth = 0;
+    _state = STATE_OBJECT;
+  }
+
+  // Inlined, so that a caller that walks a whole tree, like JsonSerializer,
+  // can keep the walker in registers
+  FORCE_INLINE Token next() {
+    for (;;) {
+      switch (_state) {
+        case STATE_VALUE:
+          if (_value->_type == JSON_ARRAY) {
+            _array = _value->_content.asArray;
+            _state = STATE_ARRAY;
+            continue;
+          }
+          if (_value->_type == JSON_OBJECT) {
+            _object = _value->_content.asObject;
+            _state = STATE_OBJECT;
+            continue;
+          }
+          _state = STATE_ELEMENT;
+          _string = _value->_content.asString;
+          if (_value->_type == JSON_STRING) return TOKEN_STRING;
+          if (_value->_type == JSON_UNPARSED) return TOKEN_RAW;
+          return TOKEN_VALUE;
+
+        case STATE_ARRAY:
+          if (!push(false)) return TOKEN_ERROR;
+          _current.element = _array->begin();
+          return TOKEN_BEGIN_ARRAY;
+
+        case STATE_OBJECT:
+          if (!push(true)) return TOKEN_ERROR;
+          _current.member = _object->begin();
+          return TOKEN_BEGIN_OBJECT;
+
+        case STATE_ELEMENT:
+          if (_depth == 0) {
+            _state = STATE_DONE;
+            return TOKEN_END;
+          }
+          if (_current.isObject) {
+            if (_current.member == JsonObject::const_iterator()) {
+              pop();
+              return TOKEN_END_OBJECT;
+            }
+            if (_current.needsComma) {
+              _current.needsComma = false;
+              return TOKEN_COMMA;
+            }
+            _string = _current.member->key;
+            _value = &_current.member->value;
+            ++_current.member;
+            _current.needsComma = true;
+            _state = STATE_VALUE;
+            return TOKEN_KEY;
+          } else {
+            if (_current.element == JsonArray::const_iterator()) {
+              pop();
+              return TOKEN_END_ARRAY;
+            }
+            if (_current.needsComma) {
+              _current.needsComma = false;
+              return TOKEN_COMMA;
+            }
+            _value = &*_current.element;
+            ++_current.element;
+            _current.needsComma = true;
+            _state = STATE_VALUE;
+            continue;
+          }
+
+        case STATE_DONE:
+          return TOKEN_END;
+
+        default:  // STATE_ERROR
+          return TOKEN_ERROR;
+      }
+    }
+  }
+
+  const char *string() const {
+    return _string;
+  }
+
+  const JsonVariant &value() const {
+    return *_value;
+  }
+
+  // After TOKEN_ERROR, value() is the nested array or object that didn't fit
+  // in the stack. skip() resumes the walk after it, so that the caller can
+  // write it by other means.
+  void skip() {
+    _state = STATE_ELEMENT;
+  }
+
+ private:
+  enum State {
+    STATE_VALUE,    // _value is next
+    STATE_ARRAY,    // _array is next
+    STATE_OBJECT,   // _object is next
+    STATE_ELEMENT,  // the next element of _current is next
+    STATE_DONE,
+    STATE_ERROR
+  };
+
+  bool push(bool isObject) {
+    if (_depth == _capacity) {
+      _state = STATE_ERROR;
+      return false;
+    }
+    if (_depth > 0) _stack[_depth - 1] = _current;
+    _depth++;
+    _current.isObject = isObject;
+    _current.needsComma = false;
+    _state = STATE_ELEMENT;
+    return true;
+  }
+
+  void pop() {
+    _depth--;
+    if (_depth > 0) _current = _stack[_depth - 1];
+  }
+
+  // the innermost array or object, out of the stack so that it can stay in
+  // registers
+  JsonWalkerFrame _current;
+  JsonWalkerFrame *_stack;
+  size_t _capacity;
+  size_t _depth;
+  State _state;
+  const JsonVariant *_value;
+  const JsonArray *_array;
+  const JsonObject *_object;
+  const char *_string;
+};
+}
+}
@@ -8,6 +8,9 @@
 #include "../Data/Encoding.hpp"
 #include "../Data/JsonInteger.hpp"
 #include "../Polyfills/attributes.hpp"
+#include "../Serialization/BulkWrite.hpp"
+#include "../Serialization/Escaping.hpp"
+#include "../Serialization/FloatDigits.hpp"
 #include "../Serialization/FloatParts.hpp"
 
 namespace ArduinoJson {
@@ -54,7 +57,10 @@ class JsonWriter {
   }
 
   void writeBoolean(bool value) {
-    writeRaw(value ? "true" : "false");
+    if (value)
+      writeRaw("true", 4);
+    else
+      writeRaw("false", 5);
   }
 
   void writeString(const char *value) {
@@ -62,7 +68,22 @@ class JsonWriter {
       writeRaw("null");
     } else {
       writeRaw('\"');
-      while (*value) writeChar(*value++);
+      // send the chars that don't need to be escaped in one call
+      const char *run = value;
+      for (;;) {
+        value += countUnescapedChars(value);
+        if (!*value) break;
+        char specialChar = Encoding::escapeChar(*value);
+        if (!specialChar) {
+          value++;
+          continue;
+        }
+        writeContent(run, size_t(value - run));
+        writeRaw('\\');
+        writeRaw(specialChar);
+        run = ++value;
+      }
+      writeContent(run, size_t(value - run));
       writeRaw('\"');
     }
   }
@@ -88,6 +109,13 @@ class JsonWriter {
 
     if (isInfinity(value)) return writeRaw("Infinity");
 
+#if ARDUINOJSON_ENABLE_SHORTEST_FLOAT_SERIALIZATION
+    if (value == 0) return writeRaw('0');
+
+    bool useExponent = value >= ARDUINOJSON_POSITIVE_EXPONENTIATION_THRESHOLD ||
+                       value <= ARDUINOJSON_NEGATIVE_EXPONENTIATION_THRESHOLD;
+    writeDigits(FloatDigits<TFloat>(value), useExponent);
+#else
     FloatParts<TFloat> parts(value);
 
     writeInteger(parts.integral);
@@ -102,21 +130,82 @@ class JsonWriter {
       writeRaw('e');
       writeInteger(parts.exponent);
     }
+#endif
+  }
+
+  template <typename TFloat>
+  void writeDigits(const FloatDigits<TFloat> &value, bool useExponent) {
+    const char *digits = value.digits;
+    int length = value.length;
+
+    if (useExponent) {
+      writeRaw(digits[0]);
+      if (length > 1) {
+        writeRaw('.');
+        writeRaw(digits + 1, size_t(length - 1));
+      }
+
+      int exponent = value.exponent + length - 1;
+      if (exponent < 0) {
+        writeRaw("e-");
+        writeInteger(-exponent);
+      }
+      if (exponent > 0) {
+        writeRaw('e');
+        writeInteger(exponent);
+      }
+      return;
+    }
+
+    // position of the dot, relative to the first digit
+    int point = length + value.exponent;
+    if (point <= 0) {
+      writeRaw("0.", 2);
+      writeZeros(-point);
+      writeRaw(digits, size_t(length));
+    } else if (point < length) {
+      writeRaw(digits, size_t(point));
+      writeRaw('.');
+      writeRaw(digits + point, size_t(length - point));
+    } else {
+      writeRaw(digits, size_t(length));
+      writeZeros(point - length);
+    }
+  }
+
+  // The number of zeros depends on the exponentiation thresholds, so it has
+  // no bound
+  void writeZeros(int count) {
+    static const char zeros[] = "0000000000000000";
+    while (count > 0) {
+      int n = count < 16 ? count : 16;
+      writeRaw(zeros, size_t(n));
+      count -= n;
+    }
   }
 
   template <typename UInt>
   void writeInteger(UInt value) {
-    char buffer[22];
-    char *end = buffer + sizeof(buffer) - 1;
+    char buffer[20];
+    char *end = buffer + sizeof(buffer);
     char *ptr = end;
 
-    *ptr = 0;
-    do {
-      *--ptr = char(value % 10 + '0');
-      value = UInt(value / 10);
-    } while (value);
+    // write the string in reverse order, two digits at a time
+    while (value >= 100) {
+      const char *digits = digitPair(uint8_t(value % 100));
+      value = UInt(value / 100);
+      *--ptr = digits[1];
+      *--ptr = digits[0];
+    }
+    if (value >= 10) {
+      const char *digits = digitPair(uint8_t(value));
+      *--ptr = digits[1];
+      *--ptr = digits[0];
+    } else {
+      *--ptr = char(value + '0');
+    }
 
-    writeRaw(ptr);
+    writeRaw(ptr, size_t(end - ptr));
   }
 
   void writeDecimals(uint32_t value, int8_t width) {
@@ -137,13 +226,39 @@ class JsonWriter {
     writeRaw(ptr);
   }
 
+  // Returns the two decimal digits of n, for n < 100
+  static const char *digitPair(uint8_t n) {
+    static const char pairs[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+    return pairs + 2 * n;
+  }
+
   void writeRaw(const char *s) {
     _length += _sink.print(s);
   }
+  void writeRaw(const char *s, size_t n) {
+    _length += bulkWrite(_sink, s, n);
+  }
   void writeRaw(char c) {
     _length += _sink.print(c);
   }
 
+  // Writes a part of a string that doesn't need to be escaped.
+  // The chars are in the document, so the Print implementation may keep a
+  // reference instead of a copy.
+  void writeContent(const char *s, size_t n) {
+    _length += writeReference(_sink, s, n);
+  }
+
  protected:
   Print &_sink;
   size_t _length;
@@ -0,0 +1,106 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include "IndentedPrint.hpp"
+#include "JsonWriter.hpp"
+
+namespace ArduinoJson {
+namespace Internals {
+
+// Writes indented JSON tokens to an IndentedPrint.
+// This class is used by JsonPrintable::prettyPrintTo(): since the
+// JsonSerializer tells it where the blocks begin and end, the output doesn't
+// need to be parsed again to be indented.
+//
+// An empty block is written as [] or {}, so the line break after the opening
+// bracket is delayed until the first value of the block.
+template <typename Print>
+class PrettyJsonWriter : public JsonWriter<IndentedPrint<Print> > {
+  typedef JsonWriter<IndentedPrint<Print> > base;
+
+ public:
+  explicit PrettyJsonWriter(IndentedPrint<Print> &sink)
+      : base(sink), _inEmptyBlock(false) {}
+
+  void beginArray() {
+    beginBlock('[');
+  }
+  void endArray() {
+    endBlock(']');
+  }
+
+  void beginObject() {
+    beginBlock('{');
+  }
+  void endObject() {
+    endBlock('}');
+  }
+
+  void writeColon() {
+    base::writeRaw(": ", 2);
+  }
+  void writeComma() {
+    base::writeRaw(",\r\n", 3);
+  }
+
+  void writeBoolean(bool value) {
+    breakLineIfNeeded();
+    base::writeBoolean(value);
+  }
+
+  void writeString(const char *value) {
+    breakLineIfNeeded();
+    base::writeString(value);
+  }
+
+  template <typename TFloat>
+  void writeFloat(TFloat value) {
+    breakLineIfNeeded();
+    base::writeFloat(value);
+  }
+
+  template <typename UInt>
+  void writeInteger(UInt value) {
+    breakLineIfNeeded();
+    base::writeInteger(value);
+  }
+
+  void writeRaw(const char *s) {
+    breakLineIfNeeded();
+    base::writeRaw(s);
+  }
+  void writeRaw(char c) {
+    breakLineIfNeeded();
+    base::writeRaw(c);
+  }
+
+ private:
+  void beginBlock(char c) {
+    breakLineIfNeeded();
+    base::writeRaw(c);
+    this->_sink.indent();
+    _inEmptyBlock = true;
+  }
+
+  void endBlock(char c) {
+    this->_sink.unindent();
+    if (_inEmptyBlock)
+      _inEmptyBlock = false;
+    else
+      base::writeRaw("\r\n", 2);
+    base::writeRaw(c);
+  }
+
+  void breakLineIfNeeded() {
+    if (!_inEmptyBlock) return;
+    _inEmptyBlock = false;
+    base::writeRaw("\r\n", 2);
+  }
+
+  bool _inEmptyBlock;
+};
+}
+}
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <string.h>  // for memcpy
+
 namespace ArduinoJson {
 namespace Internals {
 
@@ -28,6 +30,15 @@ class StaticStringBuilder {
     return size_t(p - begin);
   }
 
+  size_t write(const char *s, size_t n) {
+    size_t available = size_t(end - p);
+    if (n > available) n = available;
+    memcpy(p, s, n);
+    p += n;
+    *p = '\0';
+    return n;
+  }
+
  private:
   char *end;
   char *p;
@@ -8,30 +8,62 @@
 
 #if ARDUINOJSON_ENABLE_STD_STREAM
 
+#include <string.h>  // for memcpy, strlen
 #include <ostream>
 
 namespace ArduinoJson {
 namespace Internals {
 
+// A Print implementation that writes to a std::ostream.
+// The chars are collected in a buffer and sent with ostream::write(), because
+// ostream::operator<< is slow when called for each char.
 class StreamPrintAdapter {
  public:
-  explicit StreamPrintAdapter(std::ostream& os) : _os(os) {}
+  explicit StreamPrintAdapter(std::ostream& os) : _os(os), _size(0) {}
+
+  ~StreamPrintAdapter() {
+    flush();
+  }
 
   size_t print(char c) {
-    _os << c;
+    if (_size == bufferSize) flush();
+    _buffer[_size++] = c;
     return 1;
   }
 
   size_t print(const char* s) {
-    _os << s;
-    return strlen(s);
+    return write(s, strlen(s));
+  }
+
+  size_t write(const char* s, size_t n) {
+    if (n > bufferSize - _size) {
+      flush();
+      // a long string is sent directly
+      if (n >= bufferSize) {
+        _os.write(s, static_cast<std::streamsize>(n));
+        return n;
+      }
+    }
+    memcpy(_buffer + _size, s, n);
+    _size += n;
+    return n;
+  }
+
+  // Sends the content of the buffer to the stream
+  void flush() {
+    if (_size) _os.write(_buffer, static_cast<std::streamsize>(_size));
+    _size = 0;
   }
 
  private:
   // cannot be assigned
   StreamPrintAdapter& operator=(const StreamPrintAdapter&);
 
+  static const size_t bufferSize = 256;
+
   std::ostream& _os;
+  size_t _size;
+  char _buffer[bufferSize];
 };
 }
 }
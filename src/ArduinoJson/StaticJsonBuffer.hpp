@@ -24,6 +24,14 @@ class StaticJsonBufferBase : public JsonBufferBase<StaticJsonBufferBase> {
       }
     }
 
+    void append(const char* s, size_t n) {
+      if (_parent->canAlloc(n)) {
+        memcpy(_parent->doAlloc(n), s, n);
+      } else {
+        while (n--) append(*s++);
+      }
+    }
+
     const char* c_str() const {
       if (_parent->canAlloc(1)) {
         char* last = static_cast<char*>(_parent->doAlloc(1));
@@ -7,9 +7,13 @@
 namespace ArduinoJson {
 namespace Internals {
 
+// Base class of the readers whose input is a null-terminated string in RAM.
+// The parser uses ptr() and skip() to scan several characters at once.
+struct ContiguousReader {};
+
 template <typename TChar>
 struct CharPointerTraits {
-  class Reader {
+  class Reader : public ContiguousReader {
     const TChar* _ptr;
 
    public:
@@ -20,6 +24,14 @@ struct CharPointerTraits {
       ++_ptr;
     }
 
+    void skip(size_t n) {
+      _ptr += n;
+    }
+
+    const char* ptr() const {
+      return reinterpret_cast<const char*>(_ptr);
+    }
+
     char current() const {
       return char(_ptr[0]);
     }
@@ -35,6 +47,14 @@ struct CharPointerTraits {
     return strcmp(actual, expected) == 0;
   }
 
+  static uint32_t hash(const TChar* str) {
+    StringHash hash;
+    if (str) {
+      while (*str) hash.append(char(*str++));
+    }
+    return hash.value();
+  }
+
   static bool is_null(const TChar* str) {
     return !str;
   }
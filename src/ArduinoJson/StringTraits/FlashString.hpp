@@ -36,6 +36,16 @@ struct StringTraits<const __FlashStringHelper*, void> {
     return strcmp_P(expected, actual) == 0;
   }
 
+  static uint32_t hash(const __FlashStringHelper* str) {
+    StringHash hash;
+    const char* ptr = reinterpret_cast<const char*>(str);
+    if (ptr) {
+      for (char c = pgm_read_byte_near(ptr); c; c = pgm_read_byte_near(++ptr))
+        hash.append(c);
+    }
+    return hash.value();
+  }
+
   static bool is_null(const __FlashStringHelper* str) {
     return !str;
   }
@@ -12,34 +12,82 @@ namespace ArduinoJson {
 namespace Internals {
 
 struct StdStreamTraits {
+  // Reads the stream in blocks, directly from its streambuf.
+  // A block only contains chars that are already in the streambuf's buffer, so
+  // the chars that haven't been consumed can be returned to the stream when
+  // the reader is destroyed, as if the JSON was read one char at a time.
   class Reader {
+    static const size_t bufferSize = 64;
+
     std::istream& _stream;
-    char _current, _next;
+    size_t _begin, _end;
+    char _buffer[bufferSize];
 
    public:
-    Reader(std::istream& stream) : _stream(stream), _current(0), _next(0) {}
+    Reader(std::istream& stream) : _stream(stream), _begin(0), _end(0) {}
+
+    Reader(const Reader& other)
+        : _stream(other._stream), _begin(0), _end(0) {}
+
+    ~Reader() {
+      std::streambuf* buf = _stream.rdbuf();
+      while (_end > _begin && buf) {
+        if (buf->sungetc() == std::char_traits<char>::eof()) break;
+        _end--;
+      }
+    }
 
     void move() {
-      _current = _next;
-      _next = 0;
+      if (_begin < _end) _begin++;
     }
 
     char current() {
-      if (!_current) _current = read();
-      return _current;
+      return peek(0);
     }
 
     char next() {
-      // assumes that current() has been called
-      if (!_next) _next = read();
-      return _next;
+      return peek(1);
     }
 
    private:
     Reader& operator=(const Reader&);  // Visual Studio C4512
 
-    char read() {
-      return _stream.eof() ? '\0' : static_cast<char>(_stream.get());
+    char peek(size_t offset) {
+      while (_end - _begin <= offset) {
+        if (!read()) return '\0';
+      }
+      return _buffer[_begin + offset];
+    }
+
+    bool read() {
+      // keep the char that hasn't been consumed
+      if (_begin > 0) {
+        for (size_t i = _begin; i < _end; i++) _buffer[i - _begin] = _buffer[i];
+        _end -= _begin;
+        _begin = 0;
+      }
+
+      std::streambuf* buf = _stream.rdbuf();
+      if (!buf || !_stream.good()) return false;
+
+      // only take what's in the streambuf's buffer, because these chars can
+      // be put back
+      std::streamsize available = buf->in_avail();
+      if (available > 0) {
+        std::streamsize room = static_cast<std::streamsize>(bufferSize - _end);
+        if (available > room) available = room;
+        std::streamsize n = buf->sgetn(_buffer + _end, available);
+        _end += static_cast<size_t>(n);
+        return n > 0;
+      }
+
+      std::char_traits<char>::int_type c = buf->sbumpc();
+      if (c == std::char_traits<char>::eof()) {
+        _stream.setstate(std::ios::eofbit | std::ios::failbit);
+        return false;
+      }
+      _buffer[_end++] = std::char_traits<char>::to_char_type(c);
+      return true;
     }
   };
 
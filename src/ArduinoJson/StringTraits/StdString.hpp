@@ -46,6 +46,10 @@ struct StdStringTraits {
     return 0 == strcmp(actual, expected);
   }
 
+  static uint32_t hash(const TString& str) {
+    return CharPointerTraits<char>::hash(str.c_str());
+  }
+
   static void append(TString& str, char c) {
     str += c;
   }
@@ -54,6 +58,10 @@ struct StdStringTraits {
     str += s;
   }
 
+  static void append(TString& str, const char* s, size_t n) {
+    while (n--) str += *s++;
+  }
+
   static const bool has_append = true;
   static const bool has_equals = true;
   static const bool should_duplicate = true;
@@ -69,7 +77,13 @@ struct StringTraits<StringSumHelper, void> : StdStringTraits<StringSumHelper> {
 
 #if ARDUINOJSON_ENABLE_STD_STRING
 template <>
-struct StringTraits<std::string, void> : StdStringTraits<std::string> {};
+struct StringTraits<std::string, void> : StdStringTraits<std::string> {
+  using StdStringTraits<std::string>::append;
+
+  static void append(std::string& str, const char* s, size_t n) {
+    str.append(s, n);
+  }
+};
 #endif
 }  // namespace Internals
 }  // namespace ArduinoJson
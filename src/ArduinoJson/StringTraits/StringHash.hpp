@@ -0,0 +1,30 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#pragma once
+
+#include <stdint.h>  // for uint32_t
+
+namespace ArduinoJson {
+namespace Internals {
+
+// Computes a FNV-1a hash of a string, one character at a time.
+// Used by StringTraits<T>::hash() to feed JsonObject's key index.
+class StringHash {
+ public:
+  StringHash() : _value(2166136261UL) {}
+
+  void append(char c) {
+    _value = (_value ^ static_cast<uint8_t>(c)) * 16777619UL;
+  }
+
+  uint32_t value() const {
+    return _value;
+  }
+
+ private:
+  uint32_t _value;
+};
+}  // namespace Internals
+}  // namespace ArduinoJson
@@ -11,6 +11,7 @@
 #include "../TypeTraits/IsChar.hpp"
 #include "../TypeTraits/IsConst.hpp"
 #include "../TypeTraits/RemoveReference.hpp"
+#include "StringHash.hpp"
 
 namespace ArduinoJson {
 namespace Internals {
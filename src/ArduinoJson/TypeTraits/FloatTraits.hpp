@@ -25,6 +25,14 @@ struct FloatTraits<T, 8 /*64bits*/> {
   typedef int16_t exponent_type;
   static const exponent_type exponent_max = 308;
 
+  // Constants for the correctly rounded parseFloat()
+  static const short exponent_bias = 1023;
+  static const short smallest_power_of_ten = -342;
+  static const short largest_power_of_ten = 308;
+  static const short min_exponent_round_to_even = -4;
+  static const short max_exponent_round_to_even = 23;
+  static const short max_exact_power_of_ten = 22;
+
   template <typename TExponent>
   static T make_float(T m, TExponent e) {
     if (e > 0) {
@@ -87,6 +95,36 @@ struct FloatTraits<T, 8 /*64bits*/> {
     return factors[index];
   }
 
+  // Returns 10^e, for e from 0 to max_exact_power_of_ten
+  static T exactPowerOfTen(int e) {
+    static T factors[] = {
+        forge(0x3FF00000, 0x00000000),  // 1e0
+        forge(0x40240000, 0x00000000),  // 1e1
+        forge(0x40590000, 0x00000000),  // 1e2
+        forge(0x408F4000, 0x00000000),  // 1e3
+        forge(0x40C38800, 0x00000000),  // 1e4
+        forge(0x40F86A00, 0x00000000),  // 1e5
+        forge(0x412E8480, 0x00000000),  // 1e6
+        forge(0x416312D0, 0x00000000),  // 1e7
+        forge(0x4197D784, 0x00000000),  // 1e8
+        forge(0x41CDCD65, 0x00000000),  // 1e9
+        forge(0x4202A05F, 0x20000000),  // 1e10
+        forge(0x42374876, 0xE8000000),  // 1e11
+        forge(0x426D1A94, 0xA2000000),  // 1e12
+        forge(0x42A2309C, 0xE5400000),  // 1e13
+        forge(0x42D6BCC4, 0x1E900000),  // 1e14
+        forge(0x430C6BF5, 0x26340000),  // 1e15
+        forge(0x4341C379, 0x37E08000),  // 1e16
+        forge(0x43763457, 0x85D8A000),  // 1e17
+        forge(0x43ABC16D, 0x674EC800),  // 1e18
+        forge(0x43E158E4, 0x60913D00),  // 1e19
+        forge(0x4415AF1D, 0x78B58C40),  // 1e20
+        forge(0x444B1AE4, 0xD6E2EF50),  // 1e21
+        forge(0x4480F0CF, 0x064DD592)   // 1e22
+    };
+    return factors[e];
+  }
+
   static T nan() {
     return forge(0x7ff80000, 0x00000000);
   }
@@ -106,6 +144,19 @@ struct FloatTraits<T, 8 /*64bits*/> {
     integerBits = (uint64_t(msb) << 32) | lsb;
     return floatBits;
   }
+
+  static T fromBits(uint64_t bits) {
+    return forge(uint32_t(bits >> 32), uint32_t(bits));
+  }
+
+  static uint64_t toBits(T value) {
+    union {
+      uint64_t integerBits;
+      T floatBits;
+    };
+    floatBits = value;
+    return integerBits;
+  }
 };
 
 template <typename T>
@@ -118,6 +169,14 @@ struct FloatTraits<T, 4 /*32bits*/> {
   typedef int8_t exponent_type;
   static const exponent_type exponent_max = 38;
 
+  // Constants for the correctly rounded parseFloat()
+  static const short exponent_bias = 127;
+  static const short smallest_power_of_ten = -65;
+  static const short largest_power_of_ten = 38;
+  static const short min_exponent_round_to_even = -17;
+  static const short max_exponent_round_to_even = 10;
+  static const short max_exact_power_of_ten = 10;
+
   template <typename TExponent>
   static T make_float(T m, TExponent e) {
     if (e > 0) {
@@ -150,6 +209,26 @@ struct FloatTraits<T, 4 /*32bits*/> {
     return factors[index];
   }
 
+  // Returns 10^e, for e from 0 to max_exact_power_of_ten
+  static T exactPowerOfTen(int e) {
+    static T factors[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f,
+                          1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+    return factors[e];
+  }
+
+  static T fromBits(uint64_t bits) {
+    return forge(uint32_t(bits));
+  }
+
+  static uint64_t toBits(T value) {
+    union {
+      uint32_t integerBits;
+      T floatBits;
+    };
+    floatBits = value;
+    return integerBits;
+  }
+
   static T forge(uint32_t bits) {
     union {
       uint32_t integerBits;
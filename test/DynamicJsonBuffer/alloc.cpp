@@ -57,6 +57,20 @@ TEST_CASE("DynamicJsonBuffer::alloc()") {
     REQUIRE(allocatorLog.str() == "A1A2FFA1F");
   }
 
+  SECTION("Keeps the largest block after recycle()") {
+    allocatorLog.str("");
+    {
+      DynamicJsonBufferBase<SpyingAllocator> buffer(1);
+      buffer.alloc(1);
+      buffer.alloc(1);
+      buffer.alloc(3);
+      buffer.recycle();
+      REQUIRE(buffer.size() == 0);
+      buffer.alloc(3);
+    }
+    REQUIRE(allocatorLog.str() == "A1A2A4FFF");
+  }
+
   SECTION("Makes a big allocation when needed") {
     allocatorLog.str("");
     {
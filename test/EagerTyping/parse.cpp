@@ -0,0 +1,87 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+#include <string>
+
+TEST_CASE("Eager typing") {
+  SECTION("Converts numbers, true and false") {
+    DynamicJsonBuffer jb;
+    JsonArray& arr = jb.parseArray("[42,-42,3.14,true,false,null]");
+
+    REQUIRE(arr.success());
+    REQUIRE(arr[0].is<int>());
+    REQUIRE(arr[0] == 42);
+    REQUIRE(arr[1].is<int>());
+    REQUIRE(arr[1] == -42);
+    REQUIRE(arr[2].is<double>());
+    REQUIRE_FALSE(arr[2].is<int>());
+    REQUIRE(arr[2] == 3.14);
+    REQUIRE(arr[3].is<bool>());
+    REQUIRE(arr[3] == true);
+    REQUIRE(arr[4].is<bool>());
+    REQUIRE(arr[4] == false);
+    REQUIRE(arr[5].as<char*>() == 0);
+
+    REQUIRE(arr[0].as<char*>() == 0);  // not a string anymore
+  }
+
+  SECTION("Doesn't copy the converted values") {
+    StaticJsonBuffer<JSON_ARRAY_SIZE(5) + 8> jb;
+    JsonArray& arr = jb.parseArray("[42,-4.2e1,true,null,abcdefg]");
+
+    REQUIRE(arr.success());
+    REQUIRE(jb.size() == JSON_ARRAY_SIZE(5) + 8);
+    REQUIRE(arr[4] == "abcdefg");
+  }
+
+  SECTION("Keeps the other non-quoted strings") {
+    DynamicJsonBuffer jb;
+    std::string longValue(100, 'a');
+    JsonObject& obj = jb.parseObject("{a:value,b:1.2.3,c:" + longValue + "}");
+
+    REQUIRE(obj.success());
+    REQUIRE(obj["a"] == "value");
+    REQUIRE(obj["b"] == "1.2.3");
+    REQUIRE(obj["c"] == longValue);
+  }
+
+  SECTION("Keeps the integers that don't fit") {
+    DynamicJsonBuffer jb;
+    JsonArray& arr = jb.parseArray(
+        "[18446744073709551615,18446744073709551616,"
+        "-9223372036854775808,-9223372036854775809]");
+
+    REQUIRE(arr.success());
+    std::string json;
+    arr.printTo(json);
+    REQUIRE(json ==
+            "[18446744073709551615,18446744073709551616,"
+            "-9223372036854775808,-9223372036854775809]");
+    REQUIRE(arr[0].as<char*>() == 0);
+    REQUIRE(arr[1] == "18446744073709551616");
+    REQUIRE(arr[2].as<char*>() == 0);
+    REQUIRE(arr[3] == "-9223372036854775809");
+  }
+
+  SECTION("Converts a top-level value") {
+    DynamicJsonBuffer jb;
+    JsonVariant variant = jb.parse("-0.5");
+
+    REQUIRE(variant.is<float>());
+    REQUIRE(variant == -0.5);
+  }
+
+  SECTION("Still parses in place") {
+    DynamicJsonBuffer jb;
+    char json[] = "{\"a\":12,\"b\":\"hello\",\"c\":false}";
+    JsonObject& obj = jb.parseObject(json);
+
+    REQUIRE(obj.success());
+    REQUIRE(obj["a"] == 12);
+    REQUIRE(obj["b"] == "hello");
+    REQUIRE(obj["c"] == false);
+  }
+}
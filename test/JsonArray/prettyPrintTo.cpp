@@ -5,6 +5,8 @@
 #include <ArduinoJson.h>
 #include <catch.hpp>
 
+using namespace ArduinoJson::Internals;
+
 static void check(JsonArray& array, std::string expected) {
   std::string actual;
   size_t actualLen = array.prettyPrintTo(actual);
@@ -42,6 +44,17 @@ TEST_CASE("JsonArray::prettyPrintTo()") {
           "]");
   }
 
+  SECTION("Strings") {
+    array.add("a\"b,{c}");
+    array.add("x:y");
+
+    check(array,
+          "[\r\n"
+          "  \"a\\\"b,{c}\",\r\n"
+          "  \"x:y\"\r\n"
+          "]");
+  }
+
   SECTION("EmptyNestedArrays") {
     array.createNestedArray();
     array.createNestedArray();
@@ -72,4 +85,35 @@ TEST_CASE("JsonArray::prettyPrintTo()") {
           "  }\r\n"
           "]");
   }
+
+  SECTION("TabSize") {
+    array.add(1);
+    array.createNestedArray().add(2);
+
+    std::string actual;
+    DynamicStringBuilder<std::string> sb(actual);
+    IndentedPrint<DynamicStringBuilder<std::string> > indentedPrint(sb);
+    indentedPrint.setTabSize(8);
+    array.prettyPrintTo(indentedPrint);
+
+    REQUIRE(actual ==
+            "[\r\n"
+            "        1,\r\n"
+            "        [\r\n"
+            "                2\r\n"
+            "        ]\r\n"
+            "]");
+  }
+
+  SECTION("DeepNesting") {
+    JsonArray* nested = &array;
+    for (int i = 0; i < 19; i++) nested = &nested->createNestedArray();
+    nested->add(1);
+
+    std::string actual;
+    array.prettyPrintTo(actual);
+
+    REQUIRE(actual.find(std::string(40, ' ') + "1\r\n") != std::string::npos);
+    REQUIRE(actual.substr(actual.size() - 8) == "\r\n  ]\r\n]");
+  }
 }
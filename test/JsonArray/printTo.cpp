@@ -4,6 +4,7 @@
 
 #include <ArduinoJson.h>
 #include <catch.hpp>
+#include <stdio.h>
 
 static void check(JsonArray &array, std::string expected) {
   std::string actual;
@@ -117,6 +118,11 @@ TEST_CASE("JsonArray::printTo()") {
 
     check(array, "[false,true]");
   }
+}
+
+TEST_CASE("JsonArray::printTo() with nested containers") {
+  StaticJsonBuffer<JSON_ARRAY_SIZE(1) + JSON_OBJECT_SIZE(0)> jb;
+  JsonArray &array = jb.createArray();
 
   SECTION("OneEmptyNestedArray") {
     array.createNestedArray();
@@ -130,3 +136,32 @@ TEST_CASE("JsonArray::printTo()") {
     check(array, "[{}]");
   }
 }
+
+TEST_CASE("JsonArray::printTo() with deep nesting") {
+  DynamicJsonBuffer jb;
+  JsonArray &array = jb.createArray();
+
+  SECTION("DeeperThanTheSerializerStack") {
+    JsonArray *nested = &array;
+    for (int i = 0; i < 199; i++) nested = &nested->createNestedArray();
+    nested->add(1);
+
+    check(array, std::string(200, '[') + "1" + std::string(200, ']'));
+  }
+
+  SECTION("ArraysAndObjects") {
+    JsonArray *nested = &array;
+    for (int i = 0; i < 100; i++) {
+      nested->add(i);
+      nested = &nested->createNestedObject().createNestedArray("a");
+    }
+
+    std::string expected = "[]";
+    for (int i = 99; i >= 0; i--) {
+      char prefix[16];
+      sprintf(prefix, "[%d,{\"a\":", i);
+      expected = prefix + expected + "}]";
+    }
+    check(array, expected);
+  }
+}
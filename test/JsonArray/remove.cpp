@@ -65,4 +65,30 @@ TEST_CASE("JsonArray::remove()") {
     REQUIRE(_array[0] == 1);
     REQUIRE(_array[1] == 2);
   }
+
+  SECTION("AddAfterRemoveLast") {
+    _array.remove(2);
+    _array.add(4);
+
+    REQUIRE(3 == _array.size());
+    REQUIRE(_array[0] == 1);
+    REQUIRE(_array[1] == 2);
+    REQUIRE(_array[2] == 4);
+  }
+
+  SECTION("AddAfterRemoveAll") {
+    _array.remove(0);
+    _array.remove(0);
+    _array.remove(0);
+    _array.add(4);
+
+    REQUIRE(1 == _array.size());
+    REQUIRE(_array[0] == 4);
+  }
+
+  SECTION("RemoveOutOfRange") {
+    _array.remove(3);
+
+    REQUIRE(3 == _array.size());
+  }
 }
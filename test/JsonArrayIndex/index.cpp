@@ -0,0 +1,67 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#define ARDUINOJSON_ENABLE_ARRAY_INDEX 1
+#define ARDUINOJSON_ARRAY_INDEX_THRESHOLD 4
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+TEST_CASE("JsonArray with element index") {
+  DynamicJsonBuffer jb;
+  JsonArray& arr = jb.createArray();
+  for (int i = 0; i < 100; i++) arr.add(i);
+
+  SECTION("get()") {
+    for (int i = 0; i < 100; i++) REQUIRE(arr.get<int>(size_t(i)) == i);
+    REQUIRE(arr.get<int>(100) == 0);
+  }
+
+  SECTION("is()") {
+    REQUIRE(arr.is<int>(99));
+    REQUIRE_FALSE(arr.is<int>(100));
+  }
+
+  SECTION("set()") {
+    REQUIRE(arr.set(50, "hello"));
+    REQUIRE_FALSE(arr.set(100, "world"));
+
+    REQUIRE(arr.size() == 100);
+    REQUIRE(arr[50] == std::string("hello"));
+  }
+
+  SECTION("add() after indexed access") {
+    REQUIRE(arr[99] == 99);
+    for (int i = 100; i < 200; i++) arr.add(i);
+
+    for (int i = 0; i < 200; i++) REQUIRE(arr[i] == i);
+  }
+
+  SECTION("remove()") {
+    REQUIRE(arr[99] == 99);
+    for (int i = 0; i < 50; i++) arr.remove(size_t(i));
+
+    REQUIRE(arr.size() == 50);
+    for (int i = 0; i < 50; i++) REQUIRE(arr[i] == 2 * i + 1);
+  }
+
+  SECTION("resyncs after a removal through the List") {
+    REQUIRE(arr[99] == 99);
+    arr.Internals::List<JsonVariant>::remove(arr.begin());
+
+    REQUIRE(arr.size() == 99);
+    REQUIRE(arr[0] == 1);
+    REQUIRE(arr[98] == 99);
+  }
+}
+
+TEST_CASE("JsonArray with element index in a small StaticJsonBuffer") {
+  // enough for the array, but not for the index
+  StaticJsonBuffer<JSON_ARRAY_SIZE(5)> jb;
+  JsonArray& arr = jb.createArray();
+  for (int i = 0; i < 5; i++) arr.add(i);
+
+  REQUIRE(arr.size() == 5);
+  REQUIRE(arr[0] == 0);
+  REQUIRE(arr[4] == 4);
+}
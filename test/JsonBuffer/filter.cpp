@@ -0,0 +1,148 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+#include <sstream>
+
+template <typename T>
+static std::string toString(const T& value) {
+  std::string result;
+  value.printTo(result);
+  return result;
+}
+
+TEST_CASE("JsonBuffer::parseObject() with a JsonFilter") {
+  DynamicJsonBuffer filterBuffer;
+  DynamicJsonBuffer jb;
+
+  SECTION("Keeps the selected members") {
+    JsonFilter filter(filterBuffer.parseObject("{\"a\":true,\"c\":true}"));
+    JsonObject& obj =
+        jb.parseObject("{\"a\":1,\"b\":[1,{\"x\":2}],\"c\":\"hi\",\"d\":{}}",
+                       filter);
+
+    REQUIRE(obj.success());
+    REQUIRE(toString(obj) == "{\"a\":1,\"c\":\"hi\"}");
+  }
+
+  SECTION("Nested object filter") {
+    JsonFilter filter(filterBuffer.parseObject("{\"a\":{\"b\":true}}"));
+    JsonObject& obj =
+        jb.parseObject("{\"a\":{\"b\":[1,2],\"c\":3},\"d\":4}", filter);
+
+    REQUIRE(toString(obj) == "{\"a\":{\"b\":[1,2]}}");
+  }
+
+  SECTION("Array filter applies its first element to every element") {
+    JsonFilter filter(filterBuffer.parseObject("{\"list\":[{\"id\":true}]}"));
+    JsonObject& obj = jb.parseObject(
+        "{\"list\":[{\"id\":1,\"x\":0},{\"y\":0},{\"id\":3}],\"n\":2}", filter);
+
+    REQUIRE(toString(obj) == "{\"list\":[{\"id\":1},{},{\"id\":3}]}");
+  }
+
+  SECTION("Value of the wrong type is discarded") {
+    JsonFilter filter(
+        filterBuffer.parseObject("{\"a\":{\"b\":true},\"c\":[true]}"));
+    JsonObject& obj = jb.parseObject("{\"a\":42,\"c\":{\"d\":1}}", filter);
+
+    REQUIRE(toString(obj) == "{}");
+  }
+
+  SECTION("false discards the member") {
+    JsonFilter filter(filterBuffer.parseObject("{\"a\":false,\"b\":true}"));
+    JsonObject& obj = jb.parseObject("{\"a\":1,\"b\":2}", filter);
+
+    REQUIRE(toString(obj) == "{\"b\":2}");
+  }
+
+  SECTION("true keeps everything") {
+    JsonFilter filter(true);
+    JsonObject& obj = jb.parseObject("{\"a\":[1,{\"b\":2}]}", filter);
+
+    REQUIRE(toString(obj) == "{\"a\":[1,{\"b\":2}]}");
+  }
+
+  SECTION("Discarded values are still validated") {
+    JsonFilter filter(filterBuffer.parseObject("{\"a\":true}"));
+
+    REQUIRE_FALSE(jb.parseObject("{\"a\":1,\"b\":[1 2]}", filter).success());
+    REQUIRE_FALSE(jb.parseObject("{\"a\":1,\"b\":{\"c\"}}", filter).success());
+    REQUIRE_FALSE(jb.parseObject("{\"a\":1,\"b\":[}", filter).success());
+  }
+
+  SECTION("Discarded values count in the nesting limit") {
+    JsonFilter filter(filterBuffer.parseObject("{\"a\":true}"));
+
+    REQUIRE(jb.parseObject("{\"b\":[[]]}", filter, 3).success());
+    REQUIRE_FALSE(jb.parseObject("{\"b\":[[[]]]}", filter, 3).success());
+  }
+
+  SECTION("Discarded members take no memory") {
+    JsonFilter filter(filterBuffer.parseObject("{\"id\":true}"));
+    StaticJsonBuffer<JSON_OBJECT_SIZE(1) + 8> small;
+    JsonObject& obj = small.parseObject(
+        "{\"name\":\"a long string that doesn't fit\",\"tags\":[1,2,3],"
+        "\"id\":42,\"more\":{\"x\":\"y\"}}",
+        filter);
+
+    REQUIRE(obj.success());
+    REQUIRE(obj["id"] == 42);
+    REQUIRE(obj.size() == 1);
+  }
+
+  SECTION("Writable input") {
+    JsonFilter filter(filterBuffer.parseObject("{\"b\":true}"));
+    char json[] = "{\"a\":\"x\",\"b\":\"y\\n\"}";
+    JsonObject& obj = jb.parseObject(json, filter);
+
+    REQUIRE(obj.size() == 1);
+    REQUIRE(obj["b"] == std::string("y\n"));
+  }
+
+  SECTION("Stream") {
+    JsonFilter filter(filterBuffer.parseObject("{\"b\":true}"));
+    std::istringstream json("{\"a\":[1,2],\"b\":3}");
+    JsonObject& obj = jb.parseObject(json, filter);
+
+    REQUIRE(toString(obj) == "{\"b\":3}");
+  }
+}
+
+TEST_CASE("JsonBuffer::parseArray() with a JsonFilter") {
+  DynamicJsonBuffer filterBuffer;
+  DynamicJsonBuffer jb;
+
+  SECTION("Filters the elements") {
+    JsonFilter filter(filterBuffer.parseArray("[{\"a\":true}]"));
+    JsonArray& arr = jb.parseArray("[{\"a\":1,\"b\":2},3,{\"a\":4}]", filter);
+
+    REQUIRE(toString(arr) == "[{\"a\":1},{\"a\":4}]");
+  }
+
+  SECTION("Empty array filter discards the elements") {
+    JsonFilter filter(filterBuffer.parseArray("[]"));
+    JsonArray& arr = jb.parseArray("[1,2,3]", filter);
+
+    REQUIRE(arr.success());
+    REQUIRE(arr.size() == 0);
+  }
+}
+
+TEST_CASE("JsonBuffer::parse() with a JsonFilter") {
+  DynamicJsonBuffer filterBuffer;
+  DynamicJsonBuffer jb;
+  JsonFilter filter(filterBuffer.parseObject("{\"a\":true}"));
+
+  SECTION("Object") {
+    JsonVariant variant = jb.parse("{\"a\":1,\"b\":2}", filter);
+    REQUIRE(toString(variant) == "{\"a\":1}");
+  }
+
+  SECTION("Scalar") {
+    JsonVariant variant = jb.parse("42", filter);
+    REQUIRE(variant == 42);
+  }
+}
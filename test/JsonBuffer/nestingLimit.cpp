@@ -63,4 +63,19 @@ TEST_CASE("JsonParser nestingLimit") {
       SHOULD_FAIL(jb.parse("[{\"toto\":1}]", 1));
     }
   }
+
+  SECTION("deep documents") {
+    std::string deep = std::string(255, '[') + std::string(255, ']');
+    SHOULD_WORK(jb.parseArray(deep, 255));
+    SHOULD_FAIL(jb.parseArray("[" + deep + "]", 255));
+
+    std::string twice = "[" + std::string(40, '[') + "1" +
+                        std::string(40, ']') + "," + std::string(40, '[') +
+                        "2" + std::string(40, ']') + "]";
+    JsonArray &arr = jb.parseArray(twice, 100);
+    SHOULD_WORK(arr);
+    std::string output;
+    arr.printTo(output);
+    REQUIRE(output == twice);
+  }
 }
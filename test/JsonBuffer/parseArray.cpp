@@ -4,6 +4,7 @@
 
 #include <ArduinoJson.h>
 #include <catch.hpp>
+#include <vector>
 
 TEST_CASE("JsonBuffer::parseArray()") {
   DynamicJsonBuffer jb;
@@ -315,4 +316,53 @@ TEST_CASE("JsonBuffer::parseArray()") {
         jb.parseArray("[[[[[[[[[[[[[[[[[[[\"Not too deep\"]]]]]]]]]]]]]]]]]]]");
     REQUIRE(arr.success());
   }
+
+  SECTION("ManyElements") {
+    std::string json = "[0";
+    for (int i = 1; i < 10000; i++) json += ",1";
+    json += "]";
+
+    JsonArray& arr = jb.parseArray(json);
+
+    REQUIRE(arr.success());
+    REQUIRE(10000 == arr.size());
+    REQUIRE(arr[9999] == 1);
+  }
+
+  SECTION("StringsAndSpacesOfAnyLengthAndAlignment") {
+    for (size_t offset = 0; offset < 33; offset++) {
+      for (size_t length = 0; length < 70; length++) {
+        std::string spaces(length, ' ');
+        std::string value(length, 'x');
+        if (length > 2) value[length / 2] = '\\';
+        std::string escaped;
+        for (size_t i = 0; i < value.size(); i++) {
+          if (value[i] == '\\') escaped += '\\';
+          escaped += value[i];
+        }
+
+        std::string json = std::string(offset, ' ') + "[" + spaces + "\"" +
+                           escaped + "\"" + spaces + ",'" + escaped + "']";
+
+        DynamicJsonBuffer buffer;
+        JsonArray& arr = buffer.parseArray(json);
+        REQUIRE(arr.success());
+        REQUIRE(value == arr[0].as<std::string>());
+        REQUIRE(value == arr[1].as<std::string>());
+
+        std::vector<char> input(json.begin(), json.end());
+        input.push_back('\0');
+        JsonArray& arr2 = buffer.parseArray(&input[0]);
+        REQUIRE(arr2.success());
+        REQUIRE(value == arr2[0].as<std::string>());
+        REQUIRE(value == arr2[1].as<std::string>());
+      }
+    }
+  }
+
+  SECTION("UnterminatedLongString") {
+    JsonArray& arr =
+        jb.parseArray("[\"0123456789abcdef0123456789abcdef0123456789");
+    REQUIRE_FALSE(arr.success());
+  }
 }
@@ -168,3 +168,61 @@ TEST_CASE("JsonBuffer::parseObject()") {
     }
   }
 }
+
+TEST_CASE("JsonBuffer::parseObject() with duplicate keys") {
+  DynamicJsonBuffer jb;
+  const char* json = "{\"a\":1,\"b\":2,\"a\":3}";
+
+  SECTION("DUPLICATE_KEYS_KEEP_LAST is the default") {
+    JsonObject& obj = jb.parseObject(json);
+
+    REQUIRE(obj.success());
+    REQUIRE(obj.size() == 2);
+    REQUIRE(obj["a"] == 3);
+    REQUIRE(obj["b"] == 2);
+  }
+
+  SECTION("DUPLICATE_KEYS_KEEP_FIRST") {
+    JsonObject& obj = jb.parseObject(json, 10, DUPLICATE_KEYS_KEEP_FIRST);
+
+    REQUIRE(obj.success());
+    REQUIRE(obj.size() == 2);
+    REQUIRE(obj["a"] == 1);
+    REQUIRE(obj["b"] == 2);
+  }
+
+  SECTION("DUPLICATE_KEYS_KEEP_ALL") {
+    JsonObject& obj = jb.parseObject(json, 10, DUPLICATE_KEYS_KEEP_ALL);
+
+    REQUIRE(obj.success());
+    REQUIRE(obj.size() == 3);
+    REQUIRE(obj["a"] == 1);
+    REQUIRE(obj["b"] == 2);
+
+    std::string output;
+    obj.printTo(output);
+    REQUIRE(output == "{\"a\":1,\"b\":2,\"a\":3}");
+  }
+
+  SECTION("DUPLICATE_KEYS_REJECT") {
+    JsonObject& obj = jb.parseObject(json, 10, DUPLICATE_KEYS_REJECT);
+
+    REQUIRE_FALSE(obj.success());
+  }
+
+  SECTION("DUPLICATE_KEYS_REJECT accepts distinct keys") {
+    JsonObject& obj =
+        jb.parseObject("{\"a\":1,\"b\":{\"a\":2}}", 10, DUPLICATE_KEYS_REJECT);
+
+    REQUIRE(obj.success());
+    REQUIRE(obj["b"]["a"] == 2);
+  }
+
+  SECTION("applies to nested objects") {
+    JsonArray& arr = jb.parseArray("[{\"a\":1,\"a\":2}]", 10,
+                                   DUPLICATE_KEYS_KEEP_FIRST);
+
+    REQUIRE(arr.success());
+    REQUIRE(arr[0]["a"] == 1);
+  }
+}
@@ -20,4 +20,17 @@ TEST_CASE("JsonObject::size()") {
     _object["hello"] = 2;
     REQUIRE(1 == _object.size());
   }
+
+  SECTION("decreases when values are removed") {
+    _object.set("hello", 42);
+    _object.set("world", 43);
+    _object.remove("hello");
+    REQUIRE(1 == _object.size());
+  }
+
+  SECTION("doesn't decrease when a missing key is removed") {
+    _object.set("hello", 42);
+    _object.remove("world");
+    REQUIRE(1 == _object.size());
+  }
 }
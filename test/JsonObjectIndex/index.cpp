@@ -0,0 +1,97 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#define ARDUINOJSON_ENABLE_OBJECT_INDEX 1
+#define ARDUINOJSON_OBJECT_INDEX_THRESHOLD 4
+#include <ArduinoJson.h>
+#include <catch.hpp>
+#include <sstream>
+#include <string>
+
+static std::string keyOf(int i) {
+  std::ostringstream s;
+  s << "key" << i;
+  return s.str();
+}
+
+TEST_CASE("JsonObject with key index") {
+  DynamicJsonBuffer jb;
+  JsonObject& obj = jb.createObject();
+  for (int i = 0; i < 100; i++) obj[keyOf(i)] = i;
+
+  SECTION("finds every key") {
+    for (int i = 0; i < 100; i++) {
+      REQUIRE(obj.containsKey(keyOf(i)));
+      REQUIRE(obj[keyOf(i)] == i);
+    }
+    REQUIRE_FALSE(obj.containsKey("key100"));
+    REQUIRE_FALSE(obj.containsKey(static_cast<char*>(0)));
+  }
+
+  SECTION("doesn't add a key twice") {
+    obj["key42"] = "hello";
+
+    REQUIRE(100 == obj.size());
+    REQUIRE(obj["key42"] == std::string("hello"));
+  }
+
+  SECTION("preserves insertion order") {
+    int i = 0;
+    for (JsonObject::iterator it = obj.begin(); it != obj.end(); ++it, ++i) {
+      REQUIRE(keyOf(i) == it->key);
+    }
+    REQUIRE(100 == i);
+  }
+
+  SECTION("forgets removed keys") {
+    for (int i = 0; i < 100; i += 2) obj.remove(keyOf(i));
+
+    REQUIRE(50 == obj.size());
+    for (int i = 0; i < 100; i++) {
+      REQUIRE(obj.containsKey(keyOf(i)) == (i % 2 == 1));
+    }
+
+    obj["key0"] = 0;
+    REQUIRE(51 == obj.size());
+    REQUIRE(obj["key0"] == 0);
+  }
+
+  SECTION("resyncs after a removal through the List") {
+    JsonObject::iterator it = obj.begin();
+    obj.Internals::List<JsonPair>::remove(it);
+
+    REQUIRE_FALSE(obj.containsKey("key0"));
+    REQUIRE(obj.containsKey("key1"));
+  }
+}
+
+TEST_CASE("JsonBuffer::parseObject() with key index") {
+  DynamicJsonBuffer jb;
+
+  SECTION("keeps the last value of duplicate keys") {
+    JsonObject& obj =
+        jb.parseObject("{\"a\":1,\"b\":2,\"c\":3,\"d\":4,\"e\":5,\"a\":6}");
+
+    REQUIRE(obj.success());
+    REQUIRE(5 == obj.size());
+    REQUIRE(obj["a"] == 6);
+    REQUIRE(obj["e"] == 5);
+  }
+}
+
+TEST_CASE("JsonObject with key index in a small StaticJsonBuffer") {
+  // enough for the object, but not for the index
+  StaticJsonBuffer<JSON_OBJECT_SIZE(5)> jb;
+  JsonObject& obj = jb.createObject();
+
+  obj["a"] = 1;
+  obj["b"] = 2;
+  obj["c"] = 3;
+  obj["d"] = 4;
+  obj["e"] = 5;
+
+  REQUIRE(5 == obj.size());
+  REQUIRE(obj["a"] == 1);
+  REQUIRE(obj["e"] == 5);
+}
@@ -22,10 +22,6 @@ void check(TFloat input, const std::string& expected) {
 }
 
 TEST_CASE("JsonWriter::writeFloat(double)") {
-  SECTION("Pi") {
-    check<double>(3.14159265359, "3.141592654");
-  }
-
   SECTION("Signaling NaN") {
     double nan = std::numeric_limits<double>::signaling_NaN();
     check<double>(nan, "NaN");
@@ -47,6 +43,42 @@ TEST_CASE("JsonWriter::writeFloat(double)") {
     check<double>(-0.0, "0");
   }
 
+#if ARDUINOJSON_ENABLE_SHORTEST_FLOAT_SERIALIZATION
+  SECTION("Pi") {
+    check<double>(3.14159265359, "3.14159265359");
+  }
+
+  SECTION("Shortest representation") {
+    check<double>(0.1, "0.1");
+    check<double>(0.3, "0.3");
+    check<double>(0.1 + 0.2, "0.30000000000000004");
+    check<double>(123456.789, "123456.789");
+    check<double>(1234567.0, "1234567");
+    check<double>(5e-324, "5e-324");
+  }
+
+  SECTION("Espilon") {
+    check<double>(2.2250738585072014E-308, "2.2250738585072014e-308");
+    check<double>(-2.2250738585072014E-308, "-2.2250738585072014e-308");
+  }
+
+  SECTION("Max double") {
+    check<double>(1.7976931348623157E+308, "1.7976931348623157e308");
+    check<double>(-1.7976931348623157E+308, "-1.7976931348623157e308");
+  }
+
+  SECTION("All digits are kept") {
+    check<double>(0.000099999999999, "0.000099999999999");
+    check<double>(0.0000099999999999, "9.9999999999e-6");
+    check<double>(0.9999999996, "0.9999999996");
+    check<double>(0.1000000001, "0.1000000001");
+    check<double>(9.9999999999, "9.9999999999");
+  }
+#else
+  SECTION("Pi") {
+    check<double>(3.14159265359, "3.141592654");
+  }
+
   SECTION("Espilon") {
     check<double>(2.2250738585072014E-308, "2.225073859e-308");
     check<double>(-2.2250738585072014E-308, "-2.225073859e-308");
@@ -57,6 +89,21 @@ TEST_CASE("JsonWriter::writeFloat(double)") {
     check<double>(-1.7976931348623157E+308, "-1.797693135e308");
   }
 
+  SECTION("Rounding when too many decimals") {
+    check<double>(0.000099999999999, "0.0001");
+    check<double>(0.0000099999999999, "1e-5");
+    check<double>(0.9999999996, "1");
+  }
+
+  SECTION("10 decimal places") {
+    check<double>(0.1000000001, "0.1");
+    check<double>(0.9999999999, "1");
+
+    check<double>(9.0000000001, "9");
+    check<double>(9.9999999999, "10");
+  }
+#endif
+
   SECTION("Big exponent") {
     // this test increases coverage of normalize()
     check<double>(1e255, "1e255");
@@ -79,12 +126,6 @@ TEST_CASE("JsonWriter::writeFloat(double)") {
     check<double>(-10000000.0, "-1e7");
   }
 
-  SECTION("Rounding when too many decimals") {
-    check<double>(0.000099999999999, "0.0001");
-    check<double>(0.0000099999999999, "1e-5");
-    check<double>(0.9999999996, "1");
-  }
-
   SECTION("9 decimal places") {
     check<double>(0.100000001, "0.100000001");
     check<double>(0.999999999, "0.999999999");
@@ -92,19 +133,15 @@ TEST_CASE("JsonWriter::writeFloat(double)") {
     check<double>(9.000000001, "9.000000001");
     check<double>(9.999999999, "9.999999999");
   }
-
-  SECTION("10 decimal places") {
-    check<double>(0.1000000001, "0.1");
-    check<double>(0.9999999999, "1");
-
-    check<double>(9.0000000001, "9");
-    check<double>(9.9999999999, "10");
-  }
 }
 
 TEST_CASE("JsonWriter::writeFloat(float)") {
   SECTION("Pi") {
+#if ARDUINOJSON_ENABLE_SHORTEST_FLOAT_SERIALIZATION
+    check<float>(3.14159265359f, "3.1415927");
+#else
     check<float>(3.14159265359f, "3.141593");
+#endif
   }
 
   SECTION("999.9") {  // issue #543
@@ -114,4 +151,13 @@ TEST_CASE("JsonWriter::writeFloat(float)") {
   SECTION("24.3") {  // # issue #588
     check<float>(24.3f, "24.3");
   }
+
+#if ARDUINOJSON_ENABLE_SHORTEST_FLOAT_SERIALIZATION
+  SECTION("Shortest representation") {
+    check<float>(0.1f, "0.1");
+    check<float>(16777216.0f, "1.6777216e7");
+    check<float>(1e-45f, "1e-45");
+    check<float>(3.4028235e38f, "3.4028235e38");
+  }
+#endif
 }
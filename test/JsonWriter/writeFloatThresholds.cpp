@@ -0,0 +1,61 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+#include <string>
+
+// This file is compiled with thresholds far from the defaults, so that the
+// numbers have more zeros than any fixed-size buffer would hold.
+
+static std::string print(double value) {
+  std::string output;
+  JsonVariant(value).printTo(output);
+  return output;
+}
+
+static std::string readAll(JsonChunkedSerializer<>& serializer,
+                           size_t chunkSize) {
+  std::string result;
+  char chunk[16];
+  size_t n;
+  do {
+    n = serializer.read(chunk, chunkSize);
+    result.append(chunk, n);
+  } while (n == chunkSize);
+  return result;
+}
+
+TEST_CASE("JsonWriter::writeFloat() with custom thresholds") {
+  SECTION("Leading zeros") {
+    REQUIRE(print(1.2345678901234567e-29) ==
+            "0.000000000000000000000000000012345678901234567");
+    REQUIRE(print(-1e-30) == "-1e-30");
+  }
+
+  SECTION("Trailing zeros") {
+    REQUIRE(print(1.2345678901234567e39) ==
+            "1234567890123456700000000000000000000000");
+    REQUIRE(print(1e40) == "1e40");
+  }
+
+  SECTION("Digits on both sides of the dot") {
+    REQUIRE(print(1.5) == "1.5");
+  }
+
+  SECTION("JsonChunkedSerializer") {
+    DynamicJsonBuffer jb;
+    JsonArray& arr = jb.createArray();
+    arr.add(1.2345678901234567e-29);
+    arr.add(1.2345678901234567e39);
+    arr.add(42);
+
+    std::string expected;
+    arr.printTo(expected);
+    for (size_t chunkSize = 1; chunkSize <= 16; chunkSize++) {
+      JsonChunkedSerializer<> serializer(arr);
+      REQUIRE(readAll(serializer, chunkSize) == expected);
+    }
+  }
+}
@@ -0,0 +1,60 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <catch.hpp>
+#include <string>
+
+#include <ArduinoJson/Serialization/DynamicStringBuilder.hpp>
+#include <ArduinoJson/Serialization/JsonWriter.hpp>
+
+using namespace ArduinoJson::Internals;
+
+template <typename UInt>
+static void checkInteger(UInt input, const std::string& expected) {
+  std::string output;
+  DynamicStringBuilder<std::string> sb(output);
+  JsonWriter<DynamicStringBuilder<std::string> > writer(sb);
+  writer.writeInteger(input);
+  REQUIRE(expected == output);
+  REQUIRE(writer.bytesWritten() == expected.size());
+}
+
+TEST_CASE("JsonWriter::writeInteger()") {
+  SECTION("One digit") {
+    checkInteger<uint32_t>(0, "0");
+    checkInteger<uint32_t>(7, "7");
+    checkInteger<uint32_t>(9, "9");
+  }
+
+  SECTION("Two digits") {
+    checkInteger<uint32_t>(10, "10");
+    checkInteger<uint32_t>(42, "42");
+    checkInteger<uint32_t>(99, "99");
+  }
+
+  SECTION("Odd number of digits") {
+    checkInteger<uint32_t>(100, "100");
+    checkInteger<uint32_t>(101, "101");
+    checkInteger<uint32_t>(12345, "12345");
+  }
+
+  SECTION("Even number of digits") {
+    checkInteger<uint32_t>(1000, "1000");
+    checkInteger<uint32_t>(9999, "9999");
+    checkInteger<uint32_t>(123456, "123456");
+  }
+
+  SECTION("Max uint32_t") {
+    checkInteger<uint32_t>(4294967295U, "4294967295");
+  }
+
+  SECTION("Max uint64_t") {
+    uint64_t max = uint64_t(0xFFFFFFFF) << 32 | 0xFFFFFFFF;
+    checkInteger<uint64_t>(max, "18446744073709551615");
+  }
+
+  SECTION("Signed exponent") {
+    checkInteger<int>(308, "308");
+  }
+}
@@ -58,4 +58,24 @@ TEST_CASE("JsonWriter::writeString()") {
   SECTION("HorizontalTab") {
     check("\t", "\"\\t\"");
   }
+
+  SECTION("OtherControlChars") {
+    check("\x01\x1F", "\"\x01\x1F\"");  // not escaped
+  }
+
+  SECTION("NonAsciiChars") {
+    check("\xC3\xA9\xFF", "\"\xC3\xA9\xFF\"");
+  }
+
+  SECTION("LongStrings") {
+    // the chars to escape are at every position of the SIMD blocks
+    for (size_t i = 0; i < 70; i++) {
+      std::string input(i, 'x');
+      input += "\"";
+      input += std::string(70 - i, 'y');
+      input += "\\";
+      check(input.c_str(), "\"" + std::string(i, 'x') + "\\\"" +
+                               std::string(70 - i, 'y') + "\\\\\"");
+    }
+  }
 }
@@ -0,0 +1,87 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#define ARDUINOJSON_ENABLE_LENGTH_CACHE 1
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+static void checkLength(const JsonArray& arr) {
+  std::string json;
+  arr.printTo(json);
+  REQUIRE(arr.measureLength() == json.size());
+  REQUIRE(arr.measureLength() == json.size());  // from the cache
+}
+
+static void checkLength(const JsonObject& obj) {
+  std::string json;
+  obj.printTo(json);
+  REQUIRE(obj.measureLength() == json.size());
+  REQUIRE(obj.measureLength() == json.size());  // from the cache
+}
+
+TEST_CASE("measureLength() with length cache") {
+  DynamicJsonBuffer jb;
+  JsonArray& arr = jb.createArray();
+  arr.add(1);
+  JsonObject& obj = arr.createNestedObject();
+  obj["key"] = "value";
+  checkLength(arr);
+  checkLength(obj);
+
+  SECTION("JsonArray::add()") {
+    arr.add("hello");
+    checkLength(arr);
+  }
+
+  SECTION("JsonArray::set()") {
+    arr.set(0, 1000);
+    checkLength(arr);
+  }
+
+  SECTION("JsonArray::remove()") {
+    arr.remove(0);
+    checkLength(arr);
+  }
+
+  SECTION("JsonArraySubscript") {
+    arr[0] = "world";
+    checkLength(arr);
+  }
+
+  SECTION("JsonObject::set() with a new key") {
+    obj["other"] = 42;
+    checkLength(arr);
+    checkLength(obj);
+  }
+
+  SECTION("JsonObject::set() with an existing key") {
+    obj["key"] = "a longer value";
+    checkLength(arr);
+    checkLength(obj);
+  }
+
+  SECTION("JsonObject::remove()") {
+    obj.remove("key");
+    checkLength(arr);
+    checkLength(obj);
+  }
+
+  SECTION("Nested containers") {
+    obj.createNestedArray("nested").add(true);
+    checkLength(arr);
+    checkLength(obj);
+  }
+
+  SECTION("Value modified through an iterator") {
+    // the cache isn't invalidated, printTo() must still write everything
+    *arr.begin() = 123456;
+    std::string json;
+    arr.printTo(json);
+    REQUIRE(json == "[123456,{\"key\":\"value\"}]");
+  }
+
+  SECTION("Invalid array") {
+    REQUIRE(JsonArray::invalid().measureLength() == 2);  // []
+  }
+}
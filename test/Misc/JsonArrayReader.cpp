@@ -0,0 +1,101 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+#include <sstream>
+
+// Prints the elements on a line each, then "failed" if the input is invalid
+template <typename TString>
+static std::string readAll(JsonArrayReader<TString>& reader) {
+  std::string result;
+  while (reader.next()) {
+    reader.element().printTo(result);
+    result += "\n";
+  }
+  if (reader.failed()) result += "failed";
+  return result;
+}
+
+static std::string readString(const char* json, uint8_t nestingLimit = 10) {
+  JsonArrayReader<const char*> reader(json, nestingLimit);
+  return readAll(reader);
+}
+
+TEST_CASE("JsonArrayReader") {
+  SECTION("Elements") {
+    REQUIRE(readString("[{\"a\":1},[2,3],\"four\",5,true]") ==
+            "{\"a\":1}\n[2,3]\n\"four\"\n5\ntrue\n");
+  }
+
+  SECTION("SpacesAndComments") {
+    REQUIRE(readString(" [ 1 , /* two */ 2 // end\n ] ") == "1\n2\n");
+  }
+
+  SECTION("EmptyArray") {
+    REQUIRE(readString("[]") == "");
+    REQUIRE(readString(" [ ] ") == "");
+  }
+
+  SECTION("NotAnArray") {
+    REQUIRE(readString("{}") == "failed");
+    REQUIRE(readString("") == "failed");
+  }
+
+  SECTION("InvalidElement") {
+    REQUIRE(readString("[1,{\"a\":[}]") == "1\nfailed");
+  }
+
+  SECTION("MissingComma") {
+    REQUIRE(readString("[1 2]") == "1\nfailed");
+  }
+
+  SECTION("MissingClosingBracket") {
+    REQUIRE(readString("[1,2") == "1\n2\nfailed");
+  }
+
+  SECTION("NestingLimitIncludesTheArray") {
+    REQUIRE(readString("[[1]]", 2) == "[1]\n");
+    REQUIRE(readString("[[[1]]]", 2) == "failed");
+    REQUIRE(readString("[]", 0) == "failed");
+  }
+
+  SECTION("WritableInputIsNotModified") {
+    char json[] = "[\"a\\nb\"]";
+    JsonArrayReader<char*> reader(json);
+    REQUIRE(reader.next());
+    REQUIRE(reader.element() == std::string("a\nb"));
+    REQUIRE(std::string(json) == "[\"a\\nb\"]");
+  }
+
+  SECTION("Stream") {
+    std::istringstream json("[{\"id\":1},{\"id\":2}] rest");
+    {
+      JsonArrayReader<std::istream> reader(json);
+      REQUIRE(readAll(reader) == "{\"id\":1}\n{\"id\":2}\n");
+    }
+    std::string rest;
+    json >> rest;
+    REQUIRE(rest == "rest");
+  }
+
+  SECTION("ManyElementsInARecycledBuffer") {
+    std::string json = "[";
+    for (int i = 0; i < 1000; i++) {
+      if (i) json += ",";
+      json += "{\"name\":\"a string long enough to fill the buffer\"}";
+    }
+    json += "]";
+
+    JsonArrayReader<std::string> reader(json);
+    int count = 0;
+    while (reader.next()) {
+      REQUIRE(reader.element()["name"] ==
+              std::string("a string long enough to fill the buffer"));
+      count++;
+    }
+    REQUIRE(count == 1000);
+    REQUIRE_FALSE(reader.failed());
+  }
+}
@@ -0,0 +1,81 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+template <typename TSerializer>
+static std::string readAll(TSerializer& serializer, size_t chunkSize) {
+  std::string result;
+  char chunk[16];
+  size_t n;
+  do {
+    n = serializer.read(chunk, chunkSize);
+    result.append(chunk, n);
+  } while (n == chunkSize);
+  return result;
+}
+
+template <typename T>
+static void check(const T& root) {
+  std::string expected;
+  root.printTo(expected);
+  for (size_t chunkSize = 1; chunkSize <= 16; chunkSize++) {
+    JsonChunkedSerializer<> serializer(root);
+    REQUIRE(readAll(serializer, chunkSize) == expected);
+    REQUIRE_FALSE(serializer.failed());
+  }
+}
+
+TEST_CASE("JsonChunkedSerializer") {
+  DynamicJsonBuffer jb;
+
+  SECTION("Object") {
+    JsonObject& obj = jb.parseObject(
+        "{\"a\":[1,2.5,-3,true,null],\"b\":{},\"c\":[],\"d\":{\"e\":false}}");
+    check(obj);
+  }
+
+  SECTION("Array") {
+    JsonArray& arr = jb.createArray();
+    arr.add(1.5);
+    arr.add("hello");
+    arr.createNestedObject()["key"] = RawJson("[1,2,3]");
+    arr.createNestedArray().add(static_cast<char*>(0));
+    check(arr);
+  }
+
+  SECTION("Variant") {
+    check(JsonVariant(42));
+    check(JsonVariant("hello"));
+    check(JsonVariant(jb.parseArray("[[[]]]")));
+  }
+
+  SECTION("EscapedChars") {
+    JsonArray& arr = jb.createArray();
+    arr.add("a very long string with \"quotes\"\tand\\backslashes\r\n");
+    arr.add("\b\f\n\r\t");
+    check(arr);
+  }
+
+  SECTION("InvalidArray") {
+    JsonChunkedSerializer<> serializer(JsonArray::invalid());
+    REQUIRE(readAll(serializer, 16) == "[]");
+  }
+
+  SECTION("TooDeep") {
+    JsonArray& arr = jb.parseArray("[[[[1]]],2]");
+    JsonChunkedSerializer<3> serializer(arr);
+    REQUIRE(readAll(serializer, 16) == "[[[");
+    REQUIRE(serializer.failed());
+  }
+
+  SECTION("EndOfDocument") {
+    JsonArray& arr = jb.parseArray("[1,2]");
+    JsonChunkedSerializer<> serializer(arr);
+    char chunk[16];
+    REQUIRE(serializer.read(chunk, sizeof(chunk)) == 5);
+    REQUIRE(serializer.read(chunk, sizeof(chunk)) == 0);
+  }
+}
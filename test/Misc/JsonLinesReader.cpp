@@ -0,0 +1,83 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+#include <sstream>
+
+// Prints the records on a line each, "invalid" for the invalid ones
+static std::string readAll(JsonLinesReader& reader) {
+  std::string result;
+  while (reader.next()) {
+    JsonVariant record = reader.record();
+    if (record.success())
+      record.printTo(result);
+    else
+      result += "invalid";
+    result += "\n";
+  }
+  return result;
+}
+
+static std::string readRange(std::string input) {
+  JsonLinesReader reader(&input[0], &input[0] + input.size());
+  return readAll(reader);
+}
+
+static std::string readStream(const std::string& input) {
+  std::istringstream stream(input);
+  JsonLinesReader reader(stream);
+  return readAll(reader);
+}
+
+TEST_CASE("JsonLinesReader") {
+  SECTION("Records") {
+    const char* input = "{\"a\":1}\n[1,2]\n\"hello\"\n42\n";
+    const char* expected = "{\"a\":1}\n[1,2]\n\"hello\"\n42\n";
+    REQUIRE(readRange(input) == expected);
+    REQUIRE(readStream(input) == expected);
+  }
+
+  SECTION("LastLineWithoutNewline") {
+    const char* input = "{\"a\":1}\n{\"b\":\"x\"}";
+    const char* expected = "{\"a\":1}\n{\"b\":\"x\"}\n";
+    REQUIRE(readRange(input) == expected);
+    REQUIRE(readStream(input) == expected);
+  }
+
+  SECTION("BlankLinesAndCRLF") {
+    const char* input = "\r\n[1]\r\n\r\n  \n[2]\r\n";
+    const char* expected = "[1]\n[2]\n";
+    REQUIRE(readRange(input) == expected);
+    REQUIRE(readStream(input) == expected);
+  }
+
+  SECTION("InvalidLine") {
+    const char* input = "[1]\n[1 2]\n[3]\n";
+    const char* expected = "[1]\ninvalid\n[3]\n";
+    REQUIRE(readRange(input) == expected);
+    REQUIRE(readStream(input) == expected);
+  }
+
+  SECTION("InvalidLineDoesntSwallowTheNextOnes") {
+    const char* input = "[1,\n[2]\n{\"a\":\"x\n[3]\n";
+    const char* expected = "invalid\n[2]\ninvalid\n[3]\n";
+    REQUIRE(readRange(input) == expected);
+    REQUIRE(readStream(input) == expected);
+  }
+
+  SECTION("Empty") {
+    REQUIRE(readRange("") == "");
+    REQUIRE(readStream("") == "");
+    REQUIRE(readStream("\n\n") == "");
+  }
+
+  SECTION("RecordIsValidUntilNext") {
+    std::string input = "{\"key\":\"value\"}\n";
+    JsonLinesReader reader(&input[0], &input[0] + input.size());
+    REQUIRE(reader.next());
+    REQUIRE(reader.record()["key"] == std::string("value"));
+    REQUIRE_FALSE(reader.next());
+  }
+}
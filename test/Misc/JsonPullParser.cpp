@@ -0,0 +1,152 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+#include <sstream>
+
+// Writes the tokens in a compact form, to compare them to the expected ones
+template <typename TString>
+static std::string readAll(JsonPullParser<TString>& parser) {
+  std::string result;
+  for (;;) {
+    switch (parser.next()) {
+      case JSON_TOKEN_BEGIN_ARRAY:
+        result += "[";
+        break;
+      case JSON_TOKEN_END_ARRAY:
+        result += "]";
+        break;
+      case JSON_TOKEN_BEGIN_OBJECT:
+        result += "{";
+        break;
+      case JSON_TOKEN_END_OBJECT:
+        result += "}";
+        break;
+      case JSON_TOKEN_KEY:
+        result += std::string("K:") + parser.string() + " ";
+        break;
+      case JSON_TOKEN_STRING:
+        result += std::string("S:") + parser.string() + " ";
+        break;
+      case JSON_TOKEN_NUMBER:
+        result += std::string("N:") + parser.string() + " ";
+        break;
+      case JSON_TOKEN_BOOLEAN:
+        result += std::string("B:") + parser.string() + " ";
+        break;
+      case JSON_TOKEN_NULL:
+        result += "null ";
+        break;
+      case JSON_TOKEN_END:
+        return result;
+      case JSON_TOKEN_ERROR:
+        return result + "ERROR";
+    }
+  }
+}
+
+static std::string readAll(const char* json, size_t scratchSize = 32,
+                           uint8_t nestingLimit = 10) {
+  char scratch[32];
+  JsonPullParser<const char*> parser(json, scratch, scratchSize, nestingLimit);
+  return readAll(parser);
+}
+
+TEST_CASE("JsonPullParser") {
+  SECTION("Scalars") {
+    REQUIRE(readAll("42") == "N:42 ");
+    REQUIRE(readAll("-1.5e3") == "N:-1.5e3 ");
+    REQUIRE(readAll("'hello'") == "S:hello ");
+    REQUIRE(readAll("true") == "B:true ");
+    REQUIRE(readAll("null") == "null ");
+  }
+
+  SECTION("Array") {
+    REQUIRE(readAll("[1, \"a\", false, null]") == "[N:1 S:a B:false null ]");
+  }
+
+  SECTION("Object") {
+    REQUIRE(readAll("{\"a\":1,b:'x'}") == "{K:a N:1 K:b S:x }");
+  }
+
+  SECTION("Nested") {
+    REQUIRE(readAll("{\"a\":[[],{}],\"b\":{\"c\":[{\"d\":2}]}}") ==
+            "{K:a [[]{}]K:b {K:c [{K:d N:2 }]}}");
+  }
+
+  SECTION("SpacesAndComments") {
+    REQUIRE(readAll(" [ 1 /* one */ , // two\n 2 ] ") == "[N:1 N:2 ]");
+  }
+
+  SECTION("EscapedString") {
+    REQUIRE(readAll("[\"a\\\"b\\nc\"]") == "[S:a\"b\nc ]");
+  }
+
+  SECTION("Errors") {
+    REQUIRE(readAll("[1 2]") == "[N:1 ERROR");
+    REQUIRE(readAll("{\"a\" 1}") == "{ERROR");
+    REQUIRE(readAll("[hello]") == "[ERROR");
+    REQUIRE(readAll("[1,]") == "[N:1 ERROR");
+    REQUIRE(readAll("[1}") == "[N:1 ERROR");
+  }
+
+  SECTION("StringLongerThanScratch") {
+    REQUIRE(readAll("[\"abcdefg\"]", 8) == "[S:abcdefg ]");
+    REQUIRE(readAll("[\"abcdefgh\"]", 8) == "[ERROR");
+    REQUIRE(readAll("{\"abcdefgh\":1}", 8) == "{ERROR");
+  }
+
+  SECTION("NestingLimit") {
+    REQUIRE(readAll("[[[]]]", 32, 3) == "[[[]]]");
+    REQUIRE(readAll("[[[[]]]]", 32, 3) == "[[[ERROR");
+  }
+
+  SECTION("StopsAfterTheFirstValue") {
+    REQUIRE(readAll("[1] [2]") == "[N:1 ]");
+  }
+
+  SECTION("ErrorIsFinal") {
+    char scratch[8];
+    JsonPullParser<const char*> parser("]", scratch, sizeof(scratch));
+    REQUIRE(parser.next() == JSON_TOKEN_ERROR);
+    REQUIRE(parser.next() == JSON_TOKEN_ERROR);
+  }
+
+  SECTION("Value") {
+    char scratch[8];
+    JsonPullParser<const char*> parser("[42,true,\"7\"]", scratch,
+                                       sizeof(scratch));
+    parser.next();
+    REQUIRE(parser.next() == JSON_TOKEN_NUMBER);
+    REQUIRE(parser.value().as<int>() == 42);
+    REQUIRE(parser.next() == JSON_TOKEN_BOOLEAN);
+    REQUIRE(parser.value().as<bool>() == true);
+    REQUIRE(parser.next() == JSON_TOKEN_STRING);
+    REQUIRE(parser.value().as<int>() == 7);
+    REQUIRE(parser.depth() == 1);
+  }
+
+  SECTION("Stream") {
+    std::istringstream json("{\"values\":[1,2,3]} rest");
+    char scratch[8];
+    {
+      JsonPullParser<std::istream> parser(json, scratch, sizeof(scratch));
+      REQUIRE(readAll(parser) == "{K:values [N:1 N:2 N:3 ]}");
+    }
+    std::string rest;
+    json >> rest;
+    REQUIRE(rest == "rest");
+  }
+
+  SECTION("DeepArrayInConstantMemory") {
+    std::string json = std::string(255, '[') + std::string(255, ']');
+    char scratch[8];
+    JsonPullParser<const char*> parser(json.c_str(), scratch, sizeof(scratch),
+                                       255);
+    int tokens = 0;
+    while (parser.next() != JSON_TOKEN_END) tokens++;
+    REQUIRE(tokens == 510);
+  }
+}
@@ -0,0 +1,172 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <algorithm>
+#include <catch.hpp>
+#include <string>
+
+using namespace ArduinoJson::Internals;
+
+struct PushResult {
+  bool success;
+  std::string output;
+  size_t size;
+};
+
+template <typename TJsonBuffer>
+static PushResult parseWhole(const std::string& json, uint8_t nestingLimit) {
+  typedef CharPointerTraits<char>::Reader Reader;
+  TJsonBuffer jb;
+  JsonVariant variant =
+      JsonParser<Reader, TJsonBuffer&>(&jb, Reader(json.c_str()), jb,
+                                       nestingLimit, DUPLICATE_KEYS_KEEP_LAST)
+          .parseVariant();
+  PushResult result;
+  result.success = variant.success();
+  variant.printTo(result.output);
+  result.size = jb.size();
+  return result;
+}
+
+template <typename TJsonBuffer>
+static PushResult parseChunks(const std::string& json, size_t chunkSize,
+                              uint8_t nestingLimit) {
+  TJsonBuffer jb;
+  JsonPushParser<TJsonBuffer> parser(jb, nestingLimit);
+  for (size_t i = 0; i < json.size(); i += chunkSize) {
+    parser.feed(json.data() + i, std::min(chunkSize, json.size() - i));
+  }
+  parser.finish();
+  PushResult result;
+  result.success = parser.complete() && parser.result().success();
+  parser.result().printTo(result.output);
+  result.size = jb.size();
+  return result;
+}
+
+template <typename TJsonBuffer>
+static void checkWith(const std::string& json) {
+  for (uint8_t nestingLimit = 2; nestingLimit <= 10; nestingLimit += 8) {
+    PushResult expected = parseWhole<TJsonBuffer>(json, nestingLimit);
+    for (size_t chunkSize = 1; chunkSize <= json.size() + 1;
+         chunkSize += chunkSize < 4 ? 1 : 5) {
+      PushResult actual =
+          parseChunks<TJsonBuffer>(json, chunkSize, nestingLimit);
+      INFO(json);
+      INFO("chunkSize=" << chunkSize << " nestingLimit=" << int(nestingLimit));
+      REQUIRE(actual.success == expected.success);
+      REQUIRE(actual.output == expected.output);
+      REQUIRE(actual.size == expected.size);
+    }
+  }
+}
+
+static void check(const std::string& json) {
+  checkWith<DynamicJsonBuffer>(json);
+  checkWith<StaticJsonBuffer<128> >(json);
+}
+
+static unsigned long randomState = 42;
+
+static size_t random(size_t n) {
+  randomState = randomState * 1103515245 + 12345;
+  return (randomState >> 8) % n;
+}
+
+static std::string randomChars(const char* alphabet, size_t length) {
+  std::string alpha(alphabet);
+  std::string s;
+  for (size_t i = 0; i < length; i++) s += alpha[random(alpha.size())];
+  return s;
+}
+
+TEST_CASE("JsonPushParser gives the same result as JsonParser") {
+  SECTION("Valid documents") {
+    check("[]");
+    check("{}");
+    check("[1,2,3]");
+    check("{\"a\":1,\"b\":[true,false,null],\"c\":{\"d\":\"e\"}}");
+    check(" [ \"hello\" , \"world\" ] ");
+    check("{key:value,_k_e_y_:42}");
+    check("[\"\\\"\",\"\\\\\",\"\\\\\\\"\",\"\\n\\t\\u\"]");
+    check("['hello',{'key':'value'}]");
+    check("[1,/*comment*/2,/**/3/***/]");
+    check("[1,//comment\n2]");
+    check("{\"a\":[[[]]],\"b\":{\"c\":{}}}");
+    check("[-1.5e3,123456789012345678901234567890,0.0000001]");
+    check("\"hello\"");
+    check("42");
+    check(" true ");
+    check("[\"" + std::string(100, 'x') + "\"," + std::string(100, '9') +
+          "]");
+  }
+
+  SECTION("Invalid documents") {
+    check("");
+    check("[");
+    check("[,]");
+    check("[1,]");
+    check("[1#]");
+    check("[1\"a\"]");
+    check("[\"a\"b]");
+    check("{:1}");
+    check("{\"a\"}");
+    check("{\"a\":}");
+    check("[\"abc");
+    check("\"abc");
+    check("\"ab\\");
+    check("[1/2]");
+    check("/x");
+    check("[/*");
+    check("[1//");
+    check("12#");
+    check("]");
+  }
+
+  SECTION("Random chars") {
+    for (int i = 0; i < 500; i++) {
+      check(randomChars("{}[]:,\"'\\ /*\nab1", random(40)));
+    }
+  }
+}
+
+TEST_CASE("JsonPushParser") {
+  DynamicJsonBuffer jb;
+  JsonPushParser<DynamicJsonBuffer> parser(jb);
+
+  SECTION("Completes at the closing bracket") {
+    REQUIRE(parser.feed("{\"a\":[1,", 8));
+    REQUIRE_FALSE(parser.complete());
+    REQUIRE(parser.feed("2]}", 3));
+    REQUIRE(parser.complete());
+    REQUIRE(parser.result()["a"][1] == 2);
+  }
+
+  SECTION("Ignores what follows the value") {
+    REQUIRE(parser.feed("[1] [2]", 7));
+    REQUIRE(parser.complete());
+    REQUIRE(parser.result()[0] == 1);
+  }
+
+  SECTION("Number at the top level needs finish()") {
+    REQUIRE(parser.feed("4", 1));
+    REQUIRE(parser.feed("2", 1));
+    REQUIRE_FALSE(parser.complete());
+    REQUIRE(parser.finish());
+    REQUIRE(parser.result() == 42);
+  }
+
+  SECTION("Fails on invalid input") {
+    REQUIRE_FALSE(parser.feed("[1}", 3));
+    REQUIRE(parser.failed());
+    REQUIRE_FALSE(parser.finish());
+  }
+
+  SECTION("Incomplete input fails at finish()") {
+    REQUIRE(parser.feed("{\"a\":", 5));
+    REQUIRE_FALSE(parser.finish());
+    REQUIRE(parser.failed());
+  }
+}
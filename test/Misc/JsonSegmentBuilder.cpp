@@ -0,0 +1,72 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+static std::string join(const JsonSegmentBuilder& sb) {
+  std::string result;
+  for (size_t i = 0; i < sb.size(); i++)
+    result.append(sb.segments()[i].data, sb.segments()[i].length);
+  return result;
+}
+
+TEST_CASE("JsonSegmentBuilder") {
+  JsonSegment segments[8];
+  char scratch[32];
+  JsonSegmentBuilder sb(segments, 8, scratch, sizeof(scratch));
+  DynamicJsonBuffer jb;
+  JsonObject& obj = jb.createObject();
+
+  SECTION("ShortStringsAreCopied") {
+    obj["hello"] = "world";
+    obj["answer"] = 42;
+
+    REQUIRE(obj.printTo(sb) == 29);
+    REQUIRE(sb.size() == 1);
+    REQUIRE(join(sb) == "{\"hello\":\"world\",\"answer\":42}");
+  }
+
+  SECTION("LongStringsAreReferenced") {
+    const char* value = "a string that is long enough";
+    obj["key"] = value;
+
+    REQUIRE(obj.printTo(sb) == 38);
+    REQUIRE(sb.size() == 3);
+    REQUIRE(segments[1].data == value);
+    REQUIRE(segments[1].length == strlen(value));
+    REQUIRE(join(sb) == "{\"key\":\"a string that is long enough\"}");
+  }
+
+  SECTION("EscapedChars") {
+    obj["key"] = "a string that is long enough\nand another one too";
+
+    obj.printTo(sb);
+    REQUIRE(sb.size() == 5);
+    REQUIRE(join(sb) ==
+            "{\"key\":\"a string that is long enough\\nand another one "
+            "too\"}");
+  }
+
+  SECTION("ScratchOverflow") {
+    JsonArray& arr = obj.createNestedArray("key");
+    for (int i = 0; i < 10; i++) arr.add(1000 + i);
+
+    size_t n = obj.printTo(sb);
+    REQUIRE(n == 32);
+    REQUIRE(join(sb) == "{\"key\":[1000,1001,1002,1003,1004");
+  }
+
+  SECTION("SegmentOverflow") {
+    JsonArray& arr = obj.createNestedArray("key");
+    for (int i = 0; i < 10; i++) arr.add("a string that is long enough");
+
+    obj.printTo(sb);
+    REQUIRE(sb.size() == 8);
+    REQUIRE(join(sb) ==
+            "{\"key\":[\"a string that is long enough\",\"a string that "
+            "is long enough\",\"a string that is long enough\",\"a string "
+            "that is long enough");
+  }
+}
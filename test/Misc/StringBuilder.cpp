@@ -28,6 +28,12 @@ void common_tests(StringBuilder& sb, const String& output) {
     REQUIRE(4 == sb.print("EFGH"));
     REQUIRE(std::string("ABCDEFGH") == output);
   }
+
+  SECTION("Write") {
+    REQUIRE(3 == sb.write("ABCD", 3));
+    REQUIRE(0 == sb.write("EFGH", 0));
+    REQUIRE(std::string("ABC") == output);
+  }
 }
 
 TEST_CASE("StaticStringBuilder") {
@@ -41,6 +47,12 @@ TEST_CASE("StaticStringBuilder") {
     REQUIRE(0 == sb.print("ABC"));
     REQUIRE(std::string("ABCDEFGHIJKLMNOPQRS") == output);
   }
+
+  SECTION("WriteOverCapacity") {
+    REQUIRE(19 == sb.write("ABCDEFGHIJKLMNOPQRSTUVWXYZ", 26));
+    REQUIRE(0 == sb.write("ABC", 3));
+    REQUIRE(std::string("ABCDEFGHIJKLMNOPQRS") == output);
+  }
 }
 
 TEST_CASE("DynamicStringBuilder") {
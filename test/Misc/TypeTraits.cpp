@@ -30,6 +30,13 @@ TEST_CASE("TypeTraits") {
     REQUIRE(static_cast<bool>(IsVariant<JsonVariant>::value));
   }
 
+  SECTION("HasBulkWrite") {
+    REQUIRE(static_cast<bool>(HasBulkWrite<StaticStringBuilder>::value));
+    REQUIRE(static_cast<bool>(
+        HasBulkWrite<DynamicStringBuilder<std::string> >::value));
+    REQUIRE_FALSE(static_cast<bool>(HasBulkWrite<std::string>::value));
+  }
+
   SECTION("IsConst") {
     REQUIRE_FALSE((IsConst<char>::value));
     REQUIRE((IsConst<const char>::value));
@@ -57,6 +57,22 @@ TEST_CASE("std::stream") {
     REQUIRE("\"value\"" == os.str());
   }
 
+  SECTION("LongDocument") {
+    std::ostringstream os;
+    DynamicJsonBuffer jsonBuffer;
+    JsonArray& array = jsonBuffer.createArray();
+    std::string longString(1000, 'x');
+    for (int i = 0; i < 100; i++) {
+      array.add(i);
+      array.add("value");
+    }
+    array.add(longString);
+    std::string expected;
+    array.printTo(expected);
+    os << array;
+    REQUIRE(expected == os.str());
+  }
+
   SECTION("ParseArray") {
     std::istringstream json(" [ 42 /* comment */ ] ");
     DynamicJsonBuffer jsonBuffer;
@@ -81,4 +97,27 @@ TEST_CASE("std::stream") {
     jsonBuffer.parseObject(json);
     REQUIRE('1' == json.get());
   }
+
+  SECTION("ConsecutiveDocuments") {
+    std::istringstream json("{\"a\":1} [2,3]\n\"four\" 5");
+    DynamicJsonBuffer jsonBuffer;
+    REQUIRE(1 == jsonBuffer.parseObject(json)["a"]);
+    REQUIRE(3 == jsonBuffer.parseArray(json)[1]);
+    REQUIRE(std::string("four") == jsonBuffer.parse(json).as<std::string>());
+    REQUIRE(' ' == json.get());
+    REQUIRE('5' == json.get());
+  }
+
+  SECTION("LongInput") {
+    std::string longString(1000, 'x');
+    std::istringstream json("[\"" + longString + "\",42] rest");
+    DynamicJsonBuffer jsonBuffer;
+    JsonArray& arr = jsonBuffer.parseArray(json);
+    REQUIRE(true == arr.success());
+    REQUIRE(longString == arr[0].as<std::string>());
+    REQUIRE(42 == arr[1]);
+    std::string rest;
+    json >> rest;
+    REQUIRE("rest" == rest);
+  }
 }
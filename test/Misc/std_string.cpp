@@ -192,6 +192,16 @@ TEST_CASE("std::string") {
     REQUIRE(std::string("[4,2]") == json);
   }
 
+  SECTION("JsonArray_PrintToAppends") {
+    JsonArray &array = jb.createArray();
+    array.add("hello");
+    array.add(2.5);
+    std::string json = "json=";
+    size_t n = array.printTo(json);
+    REQUIRE(std::string("json=[\"hello\",2.5]") == json);
+    REQUIRE(n == 13);
+  }
+
   SECTION("JsonArray_PrettyPrintTo") {
     JsonArray &array = jb.createArray();
     array.add(4);
@@ -4,6 +4,7 @@
 
 #include <ArduinoJson/Polyfills/parseFloat.hpp>
 #include <catch.hpp>
+#include <stdio.h>
 
 using namespace ArduinoJson::Internals;
 
@@ -175,3 +176,70 @@ TEST_CASE("parseFloat<double>()") {
     check<double>("true", 1.0);
   }
 }
+
+#if ARDUINOJSON_ENABLE_PRECISE_FLOAT_PARSING
+template <typename T>
+void checkExact(const char* input, T expected) {
+  CAPTURE(input);
+  REQUIRE(parseFloat<T>(input) == expected);
+}
+
+TEST_CASE("parseFloat<float>() rounding") {
+  SECTION("Halfway between two floats") {
+    checkExact<float>("16777217", 16777216.0f);
+    checkExact<float>("16777219", 16777220.0f);
+  }
+
+  SECTION("Subnormals") {
+    checkExact<float>("1.4e-45", 1.4e-45f);
+    checkExact<float>("7.0064923216240862e-46", 1.4e-45f);
+  }
+
+  SECTION("Max") {
+    checkExact<float>("3.40282356e38", 3.4028235e38f);
+    checkInf<float>("3.40282357e38", false);
+  }
+
+  SECTION("Round trip") {
+    for (unsigned i = 0; i < 10000; i++) {
+      char s[32];
+      float x = float(i * 2654435761u) / 65536.0f / 4096.0f;
+      sprintf(s, "%.9g", x);
+      checkExact<float>(s, x);
+    }
+  }
+}
+
+TEST_CASE("parseFloat<double>() rounding") {
+  SECTION("Halfway between two doubles") {
+    checkExact<double>("9007199254740993", 9007199254740992.0);
+    checkExact<double>("9007199254740995", 9007199254740996.0);
+    checkExact<double>(
+        "1.00000000000000011102230246251565404236316680908203125", 1.0);
+    checkExact<double>(
+        "1.00000000000000011102230246251565404236316680908203126",
+        1.0000000000000002);
+  }
+
+  SECTION("Subnormals") {
+    checkExact<double>("2.2250738585072011e-308", 2.2250738585072009e-308);
+    checkExact<double>("4.9406564584124654e-324", 4.9406564584124654e-324);
+    checkExact<double>("2.4703282292062328e-324", 4.9406564584124654e-324);
+    checkExact<double>("2.4703282292062327e-324", 0.0);
+  }
+
+  SECTION("Max") {
+    checkExact<double>("1.7976931348623158e308", 1.7976931348623157e308);
+    checkInf<double>("1.7976931348623159e308", false);
+  }
+
+  SECTION("Round trip") {
+    for (unsigned i = 0; i < 10000; i++) {
+      char s[32];
+      double x = double(i * 2654435761u) * 1.00000001e-3 / double(i + 1);
+      sprintf(s, "%.17g", x);
+      checkExact<double>(s, x);
+    }
+  }
+}
+#endif
@@ -0,0 +1,285 @@
+// ArduinoJson - arduinojson.org
+// Copyright Benoit Blanchon 2014-2018
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+#include <string>
+#include <vector>
+
+using namespace ArduinoJson::Internals;
+
+typedef CharPointerTraits<char>::Reader Reader;
+
+enum Kind { ARRAY, OBJECT, VARIANT };
+
+struct Result {
+  bool success;
+  std::string output;
+  size_t size;
+  std::string input;  // modified by an in-place parse
+};
+
+template <typename TParser>
+static void parseWith(TParser parser, Kind kind, Result& result) {
+  switch (kind) {
+    case ARRAY: {
+      JsonArray& array = parser.parseArray();
+      result.success = array.success();
+      array.printTo(result.output);
+      break;
+    }
+    case OBJECT: {
+      JsonObject& object = parser.parseObject();
+      result.success = object.success();
+      object.printTo(result.output);
+      break;
+    }
+    default: {
+      JsonVariant variant = parser.parseVariant();
+      result.success = variant.success();
+      variant.printTo(result.output);
+      break;
+    }
+  }
+}
+
+template <template <typename, typename> class TParser, typename TJsonBuffer>
+static Result parse(const std::string& json, Kind kind, bool inPlace,
+                    uint8_t nestingLimit) {
+  TJsonBuffer jb;
+  std::vector<char> input(json.begin(), json.end());
+  input.push_back('\0');
+
+  Result result;
+  if (inPlace) {
+    parseWith(TParser<Reader, StringWriter<char> >(
+                  &jb, Reader(&input[0]), StringWriter<char>(&input[0]),
+                  nestingLimit, DUPLICATE_KEYS_KEEP_LAST),
+              kind, result);
+  } else {
+    parseWith(TParser<Reader, TJsonBuffer&>(&jb, Reader(&input[0]), jb,
+                                            nestingLimit,
+                                            DUPLICATE_KEYS_KEEP_LAST),
+              kind, result);
+  }
+  result.size = jb.size();
+  result.input.assign(input.begin(), input.end());
+  return result;
+}
+
+template <typename TJsonBuffer>
+static void checkWith(const std::string& json, uint8_t nestingLimit) {
+  for (int kind = ARRAY; kind <= VARIANT; kind++) {
+    for (int inPlace = 0; inPlace < 2; inPlace++) {
+      Result expected = parse<JsonParser, TJsonBuffer>(
+          json, Kind(kind), inPlace != 0, nestingLimit);
+      Result actual = parse<StructuralParser, TJsonBuffer>(
+          json, Kind(kind), inPlace != 0, nestingLimit);
+
+      INFO(json);
+      INFO("kind=" << kind << " inPlace=" << inPlace
+                   << " nestingLimit=" << int(nestingLimit));
+      REQUIRE(actual.success == expected.success);
+      REQUIRE(actual.output == expected.output);
+      REQUIRE(actual.size == expected.size);
+      REQUIRE(actual.input == expected.input);
+    }
+  }
+}
+
+static void check(const std::string& json) {
+  for (uint8_t nestingLimit = 2; nestingLimit <= 10; nestingLimit += 8) {
+    checkWith<DynamicJsonBuffer>(json, nestingLimit);
+    checkWith<StaticJsonBuffer<128> >(json, nestingLimit);
+  }
+}
+
+// The levels beyond the first block of the ParserStack are allocated in the
+// JsonBuffer, which must give the same size with both parsers
+static void checkDeep(const std::string& json) {
+  checkWith<DynamicJsonBuffer>(json, 255);
+  checkWith<StaticJsonBuffer<4096> >(json, 255);
+  checkWith<StaticJsonBuffer<4096> >(json, 20);
+}
+
+static unsigned long randomState = 42;
+
+static size_t random(size_t n) {
+  randomState = randomState * 1103515245 + 12345;
+  return (randomState >> 8) % n;
+}
+
+static std::string randomChars(const char* alphabet, size_t length) {
+  std::string alpha(alphabet);
+  std::string s;
+  for (size_t i = 0; i < length; i++) s += alpha[random(alpha.size())];
+  return s;
+}
+
+static std::string randomSpaces() {
+  return randomChars(" \t\r\n", random(3) ? 0 : random(80));
+}
+
+static std::string randomString() {
+  std::string s = "\"";
+  size_t length = random(5) ? random(10) : random(150);
+  for (size_t i = 0; i < length; i++) {
+    switch (random(8)) {
+      case 0:
+        s += randomChars("\\\"/'bfnrtx", 1).insert(0, "\\");
+        break;
+      case 1:
+        s += randomChars("{}[]:,/' ", 1);
+        break;
+      default:
+        s += randomChars("abc01", 1);
+        break;
+    }
+  }
+  return s + "\"";
+}
+
+static std::string randomValue(int depth) {
+  switch (random(depth > 3 ? 2 : 4)) {
+    case 0:
+      return randomString();
+    case 1:
+      return randomChars("abc01-+.e", random(5) ? 1 + random(6) : random(100));
+    case 2: {
+      std::string s = "[" + randomSpaces();
+      size_t n = random(6);
+      for (size_t i = 0; i < n; i++) {
+        if (i) s += "," + randomSpaces();
+        s += randomValue(depth + 1) + randomSpaces();
+      }
+      return s + "]";
+    }
+    default: {
+      std::string s = "{" + randomSpaces();
+      size_t n = random(6);
+      for (size_t i = 0; i < n; i++) {
+        if (i) s += "," + randomSpaces();
+        s += (random(3) ? randomString() : randomChars("abc", 3)) +
+             randomSpaces() + ":" + randomSpaces() + randomValue(depth + 1) +
+             randomSpaces();
+      }
+      return s + "}";
+    }
+  }
+}
+
+static std::string mutate(std::string s) {
+  if (s.empty()) return s;
+  size_t i = random(s.size());
+  switch (random(3)) {
+    case 0:
+      return s.erase(i, 1);
+    case 1:
+      return s.insert(i, randomChars("{}[]:,\"\\ #/'*", 1));
+    default:
+      return s.substr(0, i);
+  }
+}
+
+TEST_CASE("StructuralParser gives the same result as JsonParser") {
+  SECTION("Valid documents") {
+    check("[]");
+    check("{}");
+    check("[1,2,3]");
+    check("{\"a\":1,\"b\":[true,false,null],\"c\":{\"d\":\"e\"}}");
+    check(" [ \"hello\" , \"world\" ] ");
+    check("{key:value,_k_e_y_:42}");
+    check("[\"\\\"\",\"\\\\\",\"\\\\\\\"\",\"\\n\\t\\u\"]");
+    check("[\"{[:,]}\"]");
+    check("\"hello\"");
+    check("42");
+  }
+
+  SECTION("Invalid documents") {
+    check("");
+    check("[");
+    check("[,]");
+    check("[1,]");
+    check("[1#]");
+    check("[1 #]");
+    check("[1\"a\"]");
+    check("[\"a\"b]");
+    check("[\"a\"\"b\"]");
+    check("[\\\"a\"]");
+    check("{:1}");
+    check("{[:1}");
+    check("{a#:1}");
+    check("{\"a\"}");
+    check("{\"a\":}");
+    check("[\"abc");
+    check("\"abc");
+    check("\"ab\\");
+    check("12#");
+    check("#");
+    check("]");
+  }
+
+  SECTION("Comments and single quotes") {
+    check("[1,/*comment*/2]");
+    check("[1,//comment\n2]");
+    check("['hello']");
+    check("{'key':'value'}");
+    check("[1/2]");
+    check("/*comment*/[1]");
+    check("[12/**/]");
+    check("[12#/**/]");
+    check("[\"/*not a comment*/\",'\"']");
+
+    // the index stops at any position in a block
+    for (size_t n = 0; n < 140; n += 3) {
+      std::string spaces(n, ' ');
+      std::string chars(n, 'x');
+      check("[" + spaces + "1,/*c*/2,[3,{\"a\":4}]]");
+      check("{\"" + chars + "\":'v',\"b\":[5]}");
+      check("[\"" + chars + "\"//c\n,3]");
+      check("[" + chars + "/**/,[" + chars + "]]");
+      check("[[[" + spaces + "1]/*]*/]]");
+    }
+  }
+
+  SECTION("Deep documents") {
+    for (size_t n = 15; n <= 255; n += 16) {
+      checkDeep(std::string(n, '[') + std::string(n, ']'));
+      checkDeep(std::string(n, '[') + "1" + std::string(n, ']'));
+      std::string object;
+      for (size_t i = 0; i < n; i++) object += "{\"a\":[1,";
+      object += "2";
+      for (size_t i = 0; i < n; i++) object += "]}";
+      checkDeep("[" + object + "]");
+      checkDeep(std::string(n, '['));
+    }
+  }
+
+  SECTION("Long strings and spaces") {
+    for (size_t n = 0; n < 200; n += 7) {
+      std::string spaces(n, ' ');
+      std::string chars(n, 'x');
+      std::string backslashes(n, '\\');
+      check(spaces + "[" + spaces + "\"" + chars + "\"" + spaces + "]");
+      check("[\"" + chars + "\\\"" + chars + "\"," + chars + "]");
+      check("[\"" + backslashes + "\"]");
+      check("[\"" + backslashes + "\\\"]");
+    }
+  }
+
+  SECTION("Random documents") {
+    for (int i = 0; i < 2000; i++) {
+      std::string json = randomValue(0);
+      check(json);
+      check(mutate(json));
+    }
+  }
+
+  SECTION("Random chars") {
+    for (int i = 0; i < 2000; i++) {
+      check(randomChars("{}[]:,\"\\ ab1#", random(100)));
+      check(randomChars("{}[]:,\"'\\ /*\nab1", random(100)));
+    }
+  }
+}